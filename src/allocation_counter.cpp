@@ -0,0 +1,87 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "allocation_counter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Every replaceable form of new and delete is replaced, except the nothrow
+// forms, whose default versions call these. All are kept out of line so that
+// the compiler never sees free() applied to the result of a call to
+// operator new.
+static std::atomic<size_t> allocations{0};
+
+static void *CountedAlloc(const size_t size) {
+  allocations++;
+  if (void *p = std::malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+// aligned_alloc needs a size that is a multiple of the alignment
+static void *CountedAlloc(const size_t size, const std::align_val_t align) {
+  allocations++;
+  const auto alignment = static_cast<size_t>(align);
+  const size_t rounded = (std::max<size_t>(size, 1) + alignment - 1) &
+                         ~(alignment - 1);
+  if (void *p = std::aligned_alloc(alignment, rounded)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void *operator new(const size_t size) {
+  return CountedAlloc(size);
+}
+
+[[gnu::noinline]] void *operator new[](const size_t size) {
+  return CountedAlloc(size);
+}
+
+[[gnu::noinline]] void *operator new(const size_t size,
+                                     const std::align_val_t align) {
+  return CountedAlloc(size, align);
+}
+
+[[gnu::noinline]] void *operator new[](const size_t size,
+                                       const std::align_val_t align) {
+  return CountedAlloc(size, align);
+}
+
+[[gnu::noinline]] void operator delete(void *p) noexcept { std::free(p); }
+
+[[gnu::noinline]] void operator delete[](void *p) noexcept { std::free(p); }
+
+[[gnu::noinline]] void operator delete(void *p, size_t) noexcept {
+  std::free(p);
+}
+
+[[gnu::noinline]] void operator delete[](void *p, size_t) noexcept {
+  std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void *p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+[[gnu::noinline]] void operator delete[](void *p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void *p, size_t,
+                                       std::align_val_t) noexcept {
+  std::free(p);
+}
+
+[[gnu::noinline]] void operator delete[](void *p, size_t,
+                                         std::align_val_t) noexcept {
+  std::free(p);
+}
+
+namespace SuperH {
+size_t AllocationCount() { return allocations.load(); }
+}  // namespace SuperH
@@ -0,0 +1,16 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_ALLOCATION_COUNTER_H_
+#define SRC_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+namespace SuperH {
+// Heap allocations made by the program so far. Only for the test and
+// benchmark programs linked with allocation_counter.cpp, which replaces the
+// global operator new and delete.
+size_t AllocationCount();
+}  // namespace SuperH
+
+#endif  // SRC_ALLOCATION_COUNTER_H_
@@ -3,14 +3,20 @@
 
 #include "architecture.h"
 
+#include "fetch.h"
 #include "instructions.h"
+#include "listing.h"
+#include "pool.h"
 #include "registers.h"
 #include "sizes.h"
 
 namespace SuperH {
 // Anything applicable to the SuperH in general should go here
-Architecture::Architecture(const std::string &name)
-    : BN::Architecture(name), isa_type() {}
+Architecture::Architecture(const std::string &name, const Syntax syntax)
+    : BN::Architecture(name),
+      text_cache(GetTextRenderer(syntax)),
+      isa_type(),
+      syntax(syntax) {}
 
 BNRegisterInfo Architecture::RegisterInfo(const uint32_t fullWidthReg,
                                           const size_t offset,
@@ -26,10 +32,6 @@ BNRegisterInfo Architecture::RegisterInfo(const uint32_t fullWidthReg,
 
 size_t Architecture::GetAddressSize() const { return Sizes::LONG; }
 
-[[nodiscard]] BNEndianness Architecture::GetEndianness() const {
-  return BigEndian;
-}
-
 [[nodiscard]] size_t Architecture::GetDefaultIntegerSize() const {
   return Sizes::WORD;
 }
@@ -38,72 +40,108 @@ size_t Architecture::GetAddressSize() const { return Sizes::LONG; }
   return Sizes::WORD;
 }
 
+// A delayed branch is lifted together with the instruction in its slot
 [[nodiscard]] size_t Architecture::GetMaxInstructionLength() const {
-  return Sizes::WORD;
+  return 2 * INSTRUCTION_SIZE;
+}
+
+std::string Architecture::GetRegisterName(const uint32_t reg) {
+  const auto result = Registers::GetName(reg);
+  if (result.empty()) {
+    return "GetRegisterName: INVALID_REG_ID";
+  }
+  return std::string(result);
+}
+
+uint32_t Architecture::GetStackPointerRegister() { return Registers::R15; }
+
+const DecodeCache &Architecture::GetDecodeCache() const {
+  return decode_cache;
+}
+
+template <IsaType ISA, BNEndianness ENDIAN>
+IsaArchitecture<ISA, ENDIAN>::IsaArchitecture(const std::string &name,
+                                              const Syntax syntax)
+    : Architecture(name, syntax) {
+  this->isa_type = ISA;
 }
 
-bool Architecture::GetInstructionInfo(const uint8_t *data, const uint64_t addr,
-                                      const size_t maxLen,
-                                      BN::InstructionInfo &result) {
-  // Instructions are a minimum of 16 bits
-  if (maxLen < GetMaxInstructionLength()) {
+template <IsaType ISA, BNEndianness ENDIAN>
+[[nodiscard]] BNEndianness IsaArchitecture<ISA, ENDIAN>::GetEndianness() const {
+  return ENDIAN;
+}
+
+template <IsaType ISA, BNEndianness ENDIAN>
+bool IsaArchitecture<ISA, ENDIAN>::GetInstructionInfo(
+    const uint8_t *data, const uint64_t addr, const size_t maxLen,
+    BN::InstructionInfo &result) {
+  // Instructions are 16 bits; a slot is reported through delaySlots
+  if (maxLen < INSTRUCTION_SIZE) {
     return false;
   }
 
-  // Swap bytes to Big Endian
-  const uint16_t opcode = (static_cast<uint16_t>(data[0]) << 8) | data[1];
+  const uint16_t opcode = FetchOpcode<ENDIAN>(data);
 
-  if (const auto i = DecodeInstruction(isa_type, opcode)) {
-    return i->get()->Info(opcode, addr, result);
+  DecodedInsn insn;
+  if (decode_cache.Decode<ISA>(opcode, addr, insn)) {
+    return DispatchInfo(insn, addr, result);
   }
 
   return false;
 }
 
-bool Architecture::GetInstructionText(
+template <IsaType ISA, BNEndianness ENDIAN>
+bool IsaArchitecture<ISA, ENDIAN>::GetInstructionText(
     const uint8_t *data, const uint64_t addr, size_t &len,
     std::vector<BN::InstructionTextToken> &result) {
-  const uint16_t opcode = (static_cast<uint16_t>(data[0]) << 8) | data[1];
+  const uint16_t opcode = FetchOpcode<ENDIAN>(data);
 
-  if (const auto i = DecodeInstruction(isa_type, opcode)) {
+  // A delay slot is rendered on its own line; Info reports it through
+  // delaySlots, so analysis lifts it only together with its branch
+  DecodedInsn insn;
+  if (decode_cache.Decode<ISA>(opcode, addr, insn)) {
     len = Instruction::length;
-    return i->get()->Text(opcode, addr, len, result);
+    return text_cache.Render(insn, addr, len, result);
   }
 
   return false;
 }
 
-bool Architecture::GetInstructionLowLevelIL(const uint8_t *data,
-                                            const uint64_t addr, size_t &len,
-                                            BN::LowLevelILFunction &il) {
-  // Swap bytes to Big Endian
-  const uint16_t opcode = (static_cast<uint16_t>(data[0]) << 8) | data[1];
-
-  if (const auto i = DecodeInstruction(isa_type, opcode)) {
-    len = Instruction::length;
-    return i->get()->Lift(opcode, addr, len, il, this);
+template <IsaType ISA, BNEndianness ENDIAN>
+bool IsaArchitecture<ISA, ENDIAN>::GetInstructionLowLevelIL(
+    const uint8_t *data, const uint64_t addr, size_t &len,
+    BN::LowLevelILFunction &il) {
+  // Delayed branches are lifted together with their slot
+  DecodedPair pair;
+  if (DecodePair(data, len, addr, pair)) {
+    return LiftPair(pair, addr, len, il, this);
   }
 
   return false;
 }
 
-std::string Architecture::GetRegisterName(const uint32_t reg) {
-  auto result = Registers::to_string(reg);
-  if (result.empty()) {
-    return "GetRegisterName: INVALID_REG_ID";
-  }
-  return result;
+template <IsaType ISA, BNEndianness ENDIAN>
+bool IsaArchitecture<ISA, ENDIAN>::DecodePair(const uint8_t *data,
+                                              const size_t len,
+                                              const uint64_t addr,
+                                              DecodedPair &pair) {
+  return SuperH::DecodePair<ISA, ENDIAN>(decode_cache, data, len, addr, pair);
 }
 
-uint32_t Architecture::GetStackPointerRegister() { return Registers::R15; }
+template class IsaArchitecture<SH_1_ISA, BigEndian>;
+template class IsaArchitecture<SH_1_ISA, LittleEndian>;
+template class IsaArchitecture<SH_2E_ISA, BigEndian>;
+template class IsaArchitecture<SH_2E_ISA, LittleEndian>;
 
 // The SH-1 implements at least one instruction differently than the SH-2
 // (MAC/MAC.W)
-SH1Architecture::SH1Architecture(const std::string &name) : Architecture(name) {
-  this->isa_type = SH_1_ISA;
-}
+template <BNEndianness ENDIAN>
+BasicSH1Architecture<ENDIAN>::BasicSH1Architecture(const std::string &name,
+                                                   const Syntax syntax)
+    : IsaArchitecture<SH_1_ISA, ENDIAN>(name, syntax) {}
 
-std::vector<uint32_t> SH1Architecture::GetAllRegisters() {
+template <BNEndianness ENDIAN>
+std::vector<uint32_t> BasicSH1Architecture<ENDIAN>::GetAllRegisters() {
   return std::vector<uint32_t>{
       Registers::R0,   Registers::R1,  Registers::R2,  Registers::R3,
       Registers::R4,   Registers::R5,  Registers::R6,  Registers::R7,
@@ -113,22 +151,28 @@ std::vector<uint32_t> SH1Architecture::GetAllRegisters() {
       Registers::MACL, Registers::PR,  Registers::PC};
 }
 
-BNRegisterInfo SH1Architecture::GetRegisterInfo(const uint32_t reg) {
+template <BNEndianness ENDIAN>
+BNRegisterInfo BasicSH1Architecture<ENDIAN>::GetRegisterInfo(
+    const uint32_t reg) {
   std::vector<uint32_t> regs = GetAllRegisters();
   if (reg <= Registers::PC) {
     // All registers are 32 bits
-    return RegisterInfo(reg, 0, 4);
+    return Architecture::RegisterInfo(reg, 0, 4);
   }
-  return RegisterInfo(0, 0, 0);
+  return Architecture::RegisterInfo(0, 0, 0);
 }
 
+template class BasicSH1Architecture<BigEndian>;
+template class BasicSH1Architecture<LittleEndian>;
+
 // The SH-2 is a subset of the SH-2E (adds FPU).
-SH2EArchitecture::SH2EArchitecture(const std::string &name)
-    : Architecture(name) {
-  this->isa_type = SH_2E_ISA;
-}
+template <BNEndianness ENDIAN>
+BasicSH2EArchitecture<ENDIAN>::BasicSH2EArchitecture(
+    const std::string &name, const Syntax syntax)
+    : IsaArchitecture<SH_2E_ISA, ENDIAN>(name, syntax) {}
 
-std::vector<uint32_t> SH2EArchitecture::GetAllRegisters() {
+template <BNEndianness ENDIAN>
+std::vector<uint32_t> BasicSH2EArchitecture<ENDIAN>::GetAllRegisters() {
   return std::vector{
       Registers::R0,   Registers::R1,   Registers::R2,   Registers::R3,
       Registers::R4,   Registers::R5,   Registers::R6,   Registers::R7,
@@ -143,15 +187,20 @@ std::vector<uint32_t> SH2EArchitecture::GetAllRegisters() {
       Registers::FPSCR};
 }
 
-BNRegisterInfo SH2EArchitecture::GetRegisterInfo(const uint32_t reg) {
+template <BNEndianness ENDIAN>
+BNRegisterInfo BasicSH2EArchitecture<ENDIAN>::GetRegisterInfo(
+    const uint32_t reg) {
   if (reg <= Registers::FPSCR) {
     // All registers are 32 bits
-    return RegisterInfo(reg, 0, 4);
+    return Architecture::RegisterInfo(reg, 0, 4);
   } else {
-    return RegisterInfo(0, 0, 0);
+    return Architecture::RegisterInfo(0, 0, 0);
   }
 }
 
+template class BasicSH2EArchitecture<BigEndian>;
+template class BasicSH2EArchitecture<LittleEndian>;
+
 // Calling Convention
 class SHCallingConvention final : public BN::CallingConvention {
  public:
@@ -197,19 +246,40 @@ extern "C" {
 BN_DECLARE_CORE_ABI_VERSION
 
 BINARYNINJAPLUGIN bool CorePluginInit() {
-  BN::Architecture *sh1 = new SuperH::SH1Architecture("superh-sh1");
-  BN::Architecture::Register(sh1);
-  const BN::Ref<BN::CallingConvention> sh1_cc =
-      new SuperH::SHCallingConvention(sh1);
-  sh1->RegisterCallingConvention(sh1_cc);
-  sh1->SetDefaultCallingConvention(sh1_cc);
-
-  BN::Architecture *sh2e = new SuperH::SH2EArchitecture("superh-sh2e");
-  BN::Architecture::Register(sh2e);
-  const BN::Ref<BN::CallingConvention> sh2e_cc =
-      new SuperH::SHCallingConvention(sh2e);
-  sh2e->RegisterCallingConvention(sh2e_cc);
-  sh2e->SetDefaultCallingConvention(sh2e_cc);
+  const auto register_arch = [](BN::Architecture *arch) {
+    BN::Architecture::Register(arch);
+    const BN::Ref<BN::CallingConvention> cc =
+        new SuperH::SHCallingConvention(arch);
+    arch->RegisterCallingConvention(cc);
+    arch->SetDefaultCallingConvention(cc);
+  };
+
+  // Each architecture renders text in one syntax, fixed when it is created
+  const auto settings = BN::Settings::Instance();
+  settings->RegisterGroup("superh", "SuperH");
+  settings->RegisterSetting("superh.syntax",
+                            R"({
+    "title": "Assembly Syntax",
+    "type": "string",
+    "default": "Renesas",
+    "enum": ["Renesas", "GNU"],
+    "enumDescriptions": [
+      "As in the Renesas manuals, e.g. MOV.L @(0x2,R4),R1",
+      "As in GNU objdump, e.g. mov.l @(8,r4),r1"],
+    "description": "Disassembly syntax; takes effect after a restart.",
+    "ignore": ["SettingsProjectScope", "SettingsResourceScope"]
+  })");
+  const auto syntax = settings->Get<std::string>("superh.syntax") == "GNU"
+                          ? SuperH::Syntax::GNU
+                          : SuperH::Syntax::RENESAS;
+
+  register_arch(new SuperH::SH1Architecture("superh-sh1", syntax));
+  register_arch(new SuperH::SH2EArchitecture("superh-sh2e", syntax));
+  register_arch(new SuperH::SH1LEArchitecture("superh-sh1-le", syntax));
+  register_arch(new SuperH::SH2ELEArchitecture("superh-sh2e-le", syntax));
+
+  SuperH::RegisterListingCommand();
+  SuperH::RegisterPoolAnnotations();
 
   return true;
 }
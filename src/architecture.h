@@ -8,7 +8,10 @@
 
 #include <cstdint>
 
+#include "decode_cache.h"
+#include "delay_slot.h"
 #include "instructions.h"
+#include "text_cache.h"
 
 namespace BN = BinaryNinja;
 
@@ -19,16 +22,37 @@ class Architecture : public BN::Architecture {
   static BNRegisterInfo RegisterInfo(uint32_t fullWidthReg, size_t offset,
                                      size_t size, bool zeroExtend = false);
 
+  DecodeCache decode_cache;
+  TextCache text_cache;
+
  public:
   IsaType isa_type;
+  // Text GetInstructionText renders, fixed when the architecture is created
+  Syntax syntax;
 
-  explicit Architecture(const std::string& name);
+  // `syntax` selects the text GetInstructionText renders
+  Architecture(const std::string& name, Syntax syntax);
 
   size_t GetAddressSize() const override;
-  BNEndianness GetEndianness() const override;
   size_t GetDefaultIntegerSize() const override;
   size_t GetInstructionAlignment() const override;
   size_t GetMaxInstructionLength() const override;
+  std::string GetRegisterName(uint32_t reg) override;
+  uint32_t GetStackPointerRegister() override;
+
+  const DecodeCache& GetDecodeCache() const;
+};
+
+// Instruction callbacks specialized for one ISA and byte order, so that
+// decoding picks its tables and fetching its loads at compile time
+template <IsaType ISA, BNEndianness ENDIAN>
+class IsaArchitecture : public Architecture {
+ public:
+  explicit IsaArchitecture(const std::string& name,
+                           Syntax syntax = Syntax::RENESAS);
+
+  BNEndianness GetEndianness() const override;
+
   bool GetInstructionInfo(const uint8_t* data, uint64_t addr, size_t maxLen,
                           BN::InstructionInfo& result) override;
   bool GetInstructionText(
@@ -36,26 +60,38 @@ class Architecture : public BN::Architecture {
       std::vector<BN::InstructionTextToken>& result) override;
   bool GetInstructionLowLevelIL(const uint8_t* data, uint64_t addr, size_t& len,
                                 BN::LowLevelILFunction& il) override;
-  std::string GetRegisterName(uint32_t reg) override;
-  uint32_t GetStackPointerRegister() override;
+
+  // Decodes the instruction at `addr` with its delay slot, if any
+  bool DecodePair(const uint8_t* data, size_t len, uint64_t addr,
+                  DecodedPair& pair);
 };
 
-class SH1Architecture final : public Architecture {
+template <BNEndianness ENDIAN>
+class BasicSH1Architecture final : public IsaArchitecture<SH_1_ISA, ENDIAN> {
  public:
-  explicit SH1Architecture(const std::string& name);
+  explicit BasicSH1Architecture(const std::string& name,
+                                Syntax syntax = Syntax::RENESAS);
 
   std::vector<uint32_t> GetAllRegisters() override;
   BNRegisterInfo GetRegisterInfo(uint32_t reg) override;
 };
 
-class SH2EArchitecture final : public Architecture {
+using SH1Architecture = BasicSH1Architecture<BigEndian>;
+using SH1LEArchitecture = BasicSH1Architecture<LittleEndian>;
+
+template <BNEndianness ENDIAN>
+class BasicSH2EArchitecture final : public IsaArchitecture<SH_2E_ISA, ENDIAN> {
  public:
-  explicit SH2EArchitecture(const std::string& name);
+  explicit BasicSH2EArchitecture(const std::string& name,
+                                 Syntax syntax = Syntax::RENESAS);
 
   std::vector<uint32_t> GetAllRegisters() override;
   BNRegisterInfo GetRegisterInfo(uint32_t reg) override;
 };
 
+using SH2EArchitecture = BasicSH2EArchitecture<BigEndian>;
+using SH2ELEArchitecture = BasicSH2EArchitecture<LittleEndian>;
+
 }  // namespace SuperH
 
 #endif  // SRC_ARCHITECTURE_H_
@@ -5,48 +5,73 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <array>
+#include <cstdio>
+#include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "architecture.h"
 #include "instructions.h"
 #include "opcodes.h"
+#include "properties.h"
+#include "registers.h"
+#include "spec.h"
 
 namespace BN = BinaryNinja;
 namespace SH = SuperH;
 
-// Test that all instructions are decoded
-class TestInfoAllInstructions : public ::testing::TestWithParam<int> {};
+// Test that every instruction decodes exactly on the ISAs that implement it
+class TestInfoAllInstructions
+    : public ::testing::TestWithParam<std::tuple<SH::IsaType, int>> {};
 
 TEST_P(TestInfoAllInstructions, TestInfo) {
-  const uint16_t opcode = GetParam();
+  const auto [isa, param] = GetParam();
+  const uint16_t opcode = param;
 
   const std::array<uint8_t, 2> bytes = {
       static_cast<uint8_t>((opcode & 0xFF00) >> 8),
       static_cast<uint8_t>(opcode & 0x00FF),
   };
 
-  const auto arch = std::make_unique<SH::SH1Architecture>("shtest");
+  std::unique_ptr<SH::Architecture> arch;
+  if (isa == SH::SH_1_ISA) {
+    arch = std::make_unique<SH::SH1Architecture>("shtest");
+  } else {
+    arch = std::make_unique<SH::SH2EArchitecture>("shtest");
+  }
+  const auto spec = SH::FindSpec(SH::SH_2E_ISA, opcode);
+  ASSERT_NE(spec, nullptr);
+  const bool supported = spec->Supports(isa);
   auto result = BN::InstructionInfo{};
 
-  EXPECT_TRUE(
-      arch->GetInstructionInfo(bytes.data(), 0x0, bytes.size(), result));
-  EXPECT_EQ(result.length, SH::Instruction::length);
+  EXPECT_EQ(arch->GetInstructionInfo(bytes.data(), 0x0, bytes.size(), result),
+            supported);
+  EXPECT_EQ(result.length, supported ? SH::Instruction::length : 0);
 }
 
-// Test all instructions
+// Test all instructions on the SH-1, which lacks the SH-2 and FPU
+// instructions, and on the SH-2E, which implements all of them
 INSTANTIATE_TEST_SUITE_P(
     TestAll, TestInfoAllInstructions,
-    ::testing::ValuesIn(SH::Opcodes::GetAllOpcodes()),
+    ::testing::Combine(::testing::Values(SH::SH_1_ISA, SH::SH_2E_ISA),
+                       ::testing::ValuesIn(SH::Opcodes::GetAllOpcodes())),
     [](const testing::TestParamInfo<TestInfoAllInstructions::ParamType>& info) {
-      auto op = SH::Opcodes::NAMES.at(info.param);
+      const auto isa = std::get<0>(info.param);
+      const auto opcode = std::get<1>(info.param);
+      auto op = std::string(SH::Opcodes::GetName(opcode));
 
       // Sanitize instruction name for printing
       op.erase(std::remove_if(op.begin(), op.end(),
                               [](char c) { return c == '/' || c == '.'; }),
                op.end());
 
-      return "OP_" + op;
+      // Several instructions share a mnemonic, so add the opcode
+      char hex[5];
+      std::snprintf(hex, sizeof(hex), "%04x", opcode);
+      return std::string(isa == SH::SH_1_ISA ? "SH1" : "SH2E") + "_OP_" + op +
+             "_" + hex;
     });
 
 // Test instruction info for simple (non-branching) instructions
@@ -75,14 +100,17 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::ValuesIn(SH::Opcodes::GetSimpleOpcodes()),
     [](const testing::TestParamInfo<TestInfoSimpleInstructions::ParamType>&
            info) {
-      auto op = SH::Opcodes::NAMES.at(info.param);
+      auto op = std::string(SH::Opcodes::GetName(info.param));
 
       // Sanitize instruction name for printing
       op.erase(std::remove_if(op.begin(), op.end(),
                               [](char c) { return c == '/' || c == '.'; }),
                op.end());
 
-      return "OP_" + op;
+      // Several instructions share a mnemonic, so add the opcode
+      char opcode[5];
+      std::snprintf(opcode, sizeof(opcode), "%04x", info.param);
+      return "OP_" + op + "_" + opcode;
     });
 
 // Test instruction info for return instructions
@@ -112,7 +140,7 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(SH::Opcodes::Rte, SH::Opcodes::Rts),
     [](const testing::TestParamInfo<TestInfoReturnInstructions::ParamType>&
            info) {
-      auto op = SH::Opcodes::NAMES.at(info.param);
+      auto op = std::string(SH::Opcodes::GetName(info.param));
 
       // Sanitize instruction name for printing
       op.erase(std::remove_if(op.begin(), op.end(),
@@ -122,4 +150,195 @@ INSTANTIATE_TEST_SUITE_P(
       return "OP_" + op;
     });
 
+// Test that the callbacks for one address share a cached decode
+TEST(TestInfoDecodeCache, TestInfo) {
+  const auto arch = std::make_unique<SH::SH1Architecture>("shtest");
+  const auto &cache = arch->GetDecodeCache();
+  const auto hits = cache.GetHits();
+  const auto misses = cache.GetMisses();
+
+  // BRA with a displacement of 1 instruction
+  std::array<uint8_t, 2> bytes = {0xA0, 0x01};
+  auto result = BN::InstructionInfo{};
+  ASSERT_TRUE(
+      arch->GetInstructionInfo(bytes.data(), 0x1000, bytes.size(), result));
+  EXPECT_EQ(cache.GetMisses() - misses, 1);
+
+  size_t len = bytes.size();
+  auto tokens = std::vector<BN::InstructionTextToken>{};
+  ASSERT_TRUE(arch->GetInstructionText(bytes.data(), 0x1000, len, tokens));
+  EXPECT_EQ(cache.GetHits() - hits, 1);
+  EXPECT_EQ(cache.GetMisses() - misses, 1);
+
+  // Patched bytes at the same address must not reuse the old decode
+  bytes[1] = 0x02;
+  result = BN::InstructionInfo{};
+  ASSERT_TRUE(
+      arch->GetInstructionInfo(bytes.data(), 0x1000, bytes.size(), result));
+  EXPECT_EQ(cache.GetMisses() - misses, 2);
+  EXPECT_EQ(result.branchTarget[0], 0x1008);
+}
+
+// Test that branches and calls through a register report no constant target
+TEST(TestInfoRegisterBranches, TestInfo) {
+  const auto arch = std::make_unique<SH::SH2EArchitecture>("shtest");
+  using Bytes = std::array<uint8_t, 2>;
+
+  // BRAF R1, JMP @R1 and JMP @R5 are indirect jumps, whose target is not
+  // the register number
+  for (const auto &bytes :
+       {Bytes{0x01, 0x23}, Bytes{0x41, 0x2B}, Bytes{0x45, 0x2B}}) {
+    auto result = BN::InstructionInfo{};
+    ASSERT_TRUE(
+        arch->GetInstructionInfo(bytes.data(), 0x1000, bytes.size(), result));
+    ASSERT_EQ(result.branchCount, 1);
+    EXPECT_EQ(result.branchType[0], IndirectBranch);
+    EXPECT_EQ(result.branchTarget[0], 0);
+    EXPECT_EQ(result.delaySlots, 1);
+  }
+
+  // BSRF R1 and JSR @R1 report only their delay slot
+  for (const auto &bytes : {Bytes{0x01, 0x03}, Bytes{0x41, 0x0B}}) {
+    auto result = BN::InstructionInfo{};
+    ASSERT_TRUE(
+        arch->GetInstructionInfo(bytes.data(), 0x1000, bytes.size(), result));
+    EXPECT_EQ(result.branchCount, 0);
+    EXPECT_EQ(result.delaySlots, 1);
+  }
+}
+
+// Test that a delayed branch is decoded with its slot in one call
+TEST(TestInfoDecodePair, TestInfo) {
+  const auto arch = std::make_unique<SH::SH2EArchitecture>("shtest");
+  SH::DecodedPair pair{};
+
+  // JSR @R1; MOV.L @R4,R5
+  std::array<uint8_t, 4> bytes = {0x41, 0x0B, 0x65, 0x42};
+  ASSERT_TRUE(arch->DecodePair(bytes.data(), bytes.size(), 0x1000, pair));
+  EXPECT_EQ(pair.insn.id, SH::InsnId::JsrIndrRm);
+  ASSERT_NE(pair.slot, nullptr);
+  EXPECT_EQ(pair.slot_insn.id, SH::InsnId::MovlIndrRmRn);
+  EXPECT_EQ(pair.length, 4);
+  EXPECT_TRUE(pair.has_slot);
+  EXPECT_FALSE(pair.slot_illegal);
+  EXPECT_EQ(pair.mem_width, 4);
+  EXPECT_NE(pair.reads & SH::RegisterBit(SH::Registers::R1), 0);
+  EXPECT_NE(pair.reads & SH::RegisterBit(SH::Registers::R4), 0);
+  EXPECT_NE(pair.writes & SH::RegisterBit(SH::Registers::PR), 0);
+  EXPECT_NE(pair.writes & SH::RegisterBit(SH::Registers::R5), 0);
+
+  // The slot was cached for the callbacks at its own address
+  const auto hits = arch->GetDecodeCache().GetHits();
+  auto result = BN::InstructionInfo{};
+  ASSERT_TRUE(arch->GetInstructionInfo(bytes.data() + 2, 0x1002, 2, result));
+  EXPECT_EQ(arch->GetDecodeCache().GetHits() - hits, 1);
+
+  // RTS; BRA is illegal in the slot, as is an undefined opcode
+  bytes = {0x00, 0x0B, 0xA0, 0x00};
+  ASSERT_TRUE(arch->DecodePair(bytes.data(), bytes.size(), 0x1000, pair));
+  EXPECT_TRUE(pair.slot_illegal);
+  bytes = {0x00, 0x0B, 0xFF, 0xFF};
+  ASSERT_TRUE(arch->DecodePair(bytes.data(), bytes.size(), 0x1000, pair));
+  EXPECT_EQ(pair.slot, nullptr);
+  EXPECT_TRUE(pair.slot_illegal);
+
+  // BT has no delay slot, and a truncated pair decodes only the branch
+  bytes = {0x89, 0x01, 0x00, 0x09};
+  ASSERT_TRUE(arch->DecodePair(bytes.data(), bytes.size(), 0x1000, pair));
+  EXPECT_FALSE(pair.has_slot);
+  EXPECT_EQ(pair.length, 2);
+  EXPECT_TRUE(pair.reads_t);
+  bytes = {0x00, 0x0B, 0x00, 0x09};
+  ASSERT_TRUE(arch->DecodePair(bytes.data(), 2, 0x1000, pair));
+  EXPECT_TRUE(pair.has_slot);
+  EXPECT_EQ(pair.slot, nullptr);
+  EXPECT_EQ(pair.length, 2);
+}
+
+// Test that a delayed branch is lifted with its slot
+TEST(TestLiftDelayedBranch, TestLift) {
+  const auto arch = std::make_unique<SH::SH2EArchitecture>("shtest");
+
+  // JMP @R1; NOP
+  std::array<uint8_t, 4> bytes = {0x41, 0x2B, 0x00, 0x09};
+  BN::LowLevelILFunction nop(arch.get());
+  size_t len = bytes.size();
+  ASSERT_TRUE(arch->GetInstructionLowLevelIL(bytes.data(), 0x1000, len, nop));
+  EXPECT_EQ(len, 4);
+  EXPECT_EQ(nop.GetInstructionCount(), 2);
+
+  // JMP @R1; MOV R2,R1 jumps to R1 as it was before the slot
+  bytes = {0x41, 0x2B, 0x61, 0x23};
+  BN::LowLevelILFunction clobber(arch.get());
+  len = bytes.size();
+  ASSERT_TRUE(
+      arch->GetInstructionLowLevelIL(bytes.data(), 0x1000, len, clobber));
+  EXPECT_EQ(len, 4);
+  EXPECT_EQ(clobber.GetInstructionCount(), 3);
+
+  // RTS; BRA is illegal in the slot
+  bytes = {0x00, 0x0B, 0xA0, 0x00};
+  BN::LowLevelILFunction illegal(arch.get());
+  len = bytes.size();
+  ASSERT_TRUE(
+      arch->GetInstructionLowLevelIL(bytes.data(), 0x1000, len, illegal));
+  EXPECT_EQ(len, 4);
+  EXPECT_EQ(illegal.GetInstructionCount(), 1);
+
+  // RTS; STS MACH,R1 has no lift yet, so it stands in as unimplemented before
+  // the return
+  bytes = {0x00, 0x0B, 0x01, 0x0A};
+  BN::LowLevelILFunction unlifted(arch.get());
+  len = bytes.size();
+  ASSERT_TRUE(
+      arch->GetInstructionLowLevelIL(bytes.data(), 0x1000, len, unlifted));
+  EXPECT_EQ(len, 4);
+  EXPECT_EQ(unlifted.GetInstructionCount(), 2);
+
+  // Without the slot's bytes only the branch is lifted
+  bytes = {0x41, 0x2B, 0x00, 0x09};
+  BN::LowLevelILFunction truncated(arch.get());
+  len = 2;
+  ASSERT_TRUE(
+      arch->GetInstructionLowLevelIL(bytes.data(), 0x1000, len, truncated));
+  EXPECT_EQ(len, 2);
+  EXPECT_EQ(truncated.GetInstructionCount(), 1);
+}
+
+// Test that given as many bytes as the architecture advertises, every delayed
+// branch is lifted with its slot and covers the bytes its Info reports
+TEST(TestLiftDelayedBranch, TestMaxLength) {
+  const auto arch = std::make_unique<SH::SH2EArchitecture>("shtest");
+  ASSERT_EQ(arch->GetMaxInstructionLength(), 2 * INSTRUCTION_SIZE);
+
+  for (const auto &spec : SH::SPECS) {
+    if (!spec.Supports(SH::SH_2E_ISA) || !SH::PropertiesOf(spec).delay_slot) {
+      continue;
+    }
+    // The branch, then NOP in its slot
+    const uint16_t opcode = spec.Match();
+    const std::array<uint8_t, 4> bytes = {static_cast<uint8_t>(opcode >> 8),
+                                          static_cast<uint8_t>(opcode & 0xFF),
+                                          0x00, 0x09};
+
+    auto result = BN::InstructionInfo{};
+    ASSERT_TRUE(arch->GetInstructionInfo(bytes.data(), 0x1000,
+                                         arch->GetMaxInstructionLength(),
+                                         result))
+        << spec.pattern;
+    EXPECT_EQ(result.delaySlots, 1) << spec.pattern;
+
+    BN::LowLevelILFunction il(arch.get());
+    size_t len = arch->GetMaxInstructionLength();
+    ASSERT_TRUE(arch->GetInstructionLowLevelIL(bytes.data(), 0x1000, len, il))
+        << spec.pattern;
+    EXPECT_EQ(len, result.length * (1 + result.delaySlots)) << spec.pattern;
+  }
+
+  // The last instruction of a segment still has info
+  const std::array<uint8_t, 2> nop = {0x00, 0x09};
+  auto result = BN::InstructionInfo{};
+  EXPECT_TRUE(arch->GetInstructionInfo(nop.data(), 0x1000, nop.size(), result));
+}
+
 // TODO: Add tests for complex branching instructions
\ No newline at end of file
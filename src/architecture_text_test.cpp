@@ -12,6 +12,9 @@
 #include "instructions.h"
 #include "opcodes.h"
 #include "registers.h"
+#include "render.h"
+#include "spec.h"
+#include "text_cache.h"
 
 namespace BN = BinaryNinja;
 namespace SH = SuperH;
@@ -69,7 +72,7 @@ class TestText0 : public ::testing::TestWithParam<int> {};
 TEST_P(TestText0, TestText) {
   const uint16_t opcode = GetParam();
   const std::vector<BN::InstructionTextToken> want = {
-      {InstructionToken, SH::Opcodes::NAMES.at(opcode)},
+      {InstructionToken, std::string(SH::Opcodes::GetName(opcode))},
   };
 
   test_architecture_text(opcode, 0x0, want);
@@ -82,7 +85,7 @@ INSTANTIATE_TEST_SUITE_P(
                       SH::Opcodes::Div0u, SH::Opcodes::Nop, SH::Opcodes::Rte,
                       SH::Opcodes::Rts, SH::Opcodes::Sett, SH::Opcodes::Sleep),
     [](const testing::TestParamInfo<TestText0::ParamType> &info) {
-      const auto op = SH::Opcodes::NAMES.at(info.param);
+      const auto op = std::string(SH::Opcodes::GetName(info.param));
       return "OP_" + op;
     });
 
@@ -94,9 +97,9 @@ TEST_P(TestTextRn, TestText) {
   const SH::N rn = std::get<1>(GetParam());
 
   const std::vector<BN::InstructionTextToken> want = {
-      {InstructionToken, SH::Opcodes::NAMES.at(opcode)},
+      {InstructionToken, std::string(SH::Opcodes::GetName(opcode))},
       {TextToken, " "},
-      {RegisterToken, SH::Registers::to_string(rn)},
+      {RegisterToken, std::string(SH::Registers::GetName(rn))},
   };
 
   opcode = SH::SetNFormatOpcodeField(opcode, rn);
@@ -114,8 +117,8 @@ INSTANTIATE_TEST_SUITE_P(
                           SH::Opcodes::ShlrRn),
         ::testing::Range(0, 16)),  // All gp registers
     [](const testing::TestParamInfo<TestTextRn::ParamType> &info) {
-      auto op = SH::Opcodes::NAMES.at(std::get<0>(info.param));
-      const auto rn = SH::Registers::to_string(std::get<1>(info.param));
+      auto op = std::string(SH::Opcodes::GetName(std::get<0>(info.param)));
+      const std::string rn{SH::Registers::GetName(std::get<1>(info.param))};
 
       // Sanitize instruction name for printing
       op.erase(std::remove_if(op.begin(), op.end(),
@@ -135,11 +138,11 @@ TEST_P(TestTextRmRn, TestText) {
   const SH::N rn = std::get<2>(GetParam());
 
   const std::vector<BN::InstructionTextToken> want = {
-      {InstructionToken, SH::Opcodes::NAMES.at(opcode)},
+      {InstructionToken, std::string(SH::Opcodes::GetName(opcode))},
       {TextToken, " "},
-      {RegisterToken, SH::Registers::to_string(rm)},
+      {RegisterToken, std::string(SH::Registers::GetName(rm))},
       {OperandSeparatorToken, ","},
-      {RegisterToken, SH::Registers::to_string(rn)},
+      {RegisterToken, std::string(SH::Registers::GetName(rn))},
   };
 
   opcode = SH::SetNMFormatOpcodeFields(opcode, rn, rm);
@@ -168,9 +171,9 @@ INSTANTIATE_TEST_SUITE_P(
                           SH::Opcodes::XtrctRmRn),
         ::testing::Range(0, 16), ::testing::Range(0, 16)),
     [](const testing::TestParamInfo<TestTextRmRn::ParamType> &info) {
-      auto op = SH::Opcodes::NAMES.at(std::get<0>(info.param));
-      const auto rm = SH::Registers::to_string(std::get<1>(info.param));
-      const auto rn = SH::Registers::to_string(std::get<2>(info.param));
+      auto op = std::string(SH::Opcodes::GetName(std::get<0>(info.param)));
+      const std::string rm{SH::Registers::GetName(std::get<1>(info.param))};
+      const std::string rn{SH::Registers::GetName(std::get<2>(info.param))};
 
       // Sanitize instruction name for printing
       op.erase(std::remove_if(op.begin(), op.end(),
@@ -179,3 +182,160 @@ INSTANTIATE_TEST_SUITE_P(
 
       return "OP_" + op + "_RM_" + rm + "_RN_" + rn;
     });
+
+// Test that little-endian architectures decode byte-swapped opcodes the same
+template <class BE, class LE>
+static void test_little_endian_text() {
+  const auto be = std::make_unique<BE>("shtest");
+  const auto le = std::make_unique<LE>("shtest-le");
+  EXPECT_EQ(be->GetEndianness(), BigEndian);
+  EXPECT_EQ(le->GetEndianness(), LittleEndian);
+
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    const std::array<uint8_t, 2> big = {static_cast<uint8_t>(opcode >> 8),
+                                        static_cast<uint8_t>(opcode & 0xFF)};
+    const std::array<uint8_t, 2> little = {big[1], big[0]};
+
+    size_t be_len = big.size(), le_len = little.size();
+    std::vector<BN::InstructionTextToken> want, got;
+    ASSERT_EQ(be->GetInstructionText(big.data(), 0x1000, be_len, want),
+              le->GetInstructionText(little.data(), 0x1000, le_len, got))
+        << "opcode 0x" << std::hex << opcode;
+    ASSERT_EQ(tokens_to_string(want), tokens_to_string(got))
+        << "opcode 0x" << std::hex << opcode;
+  }
+}
+
+TEST(TestTextLittleEndian, TestSH1) {
+  test_little_endian_text<SH::SH1Architecture, SH::SH1LEArchitecture>();
+}
+
+TEST(TestTextLittleEndian, TestSH2E) {
+  test_little_endian_text<SH::SH2EArchitecture, SH::SH2ELEArchitecture>();
+}
+
+// Test that text served from the token cache matches freshly formatted text,
+// with PC-relative targets following the address
+TEST(TestTextCache, TestAddresses) {
+  const auto arch = std::make_unique<SH::SH2EArchitecture>("shtest");
+
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    const std::array<uint8_t, 2> bytes = {static_cast<uint8_t>(opcode >> 8),
+                                          static_cast<uint8_t>(opcode & 0xFF)};
+    for (const uint64_t addr : {0x1000, 0x2000, 0x1000}) {
+      SH::DecodedInsn insn;
+      if (!SH::DecodeInstruction(SH::SH_2E_ISA, opcode, addr, insn)) {
+        continue;
+      }
+      size_t want_len = bytes.size(), got_len = bytes.size();
+      std::vector<BN::InstructionTextToken> want, got;
+      ASSERT_TRUE(SH::DispatchText(insn, addr, want_len, want));
+      ASSERT_TRUE(arch->GetInstructionText(bytes.data(), addr, got_len, got));
+      ASSERT_EQ(got_len, want_len);
+      ASSERT_EQ(got.size(), want.size()) << "opcode 0x" << std::hex << opcode;
+      for (size_t i = 0; i < want.size(); i++) {
+        EXPECT_EQ(got[i].type, want[i].type);
+        EXPECT_EQ(got[i].text, want[i].text);
+        EXPECT_EQ(got[i].value, want[i].value);
+      }
+    }
+  }
+}
+
+// Test that the cache keeps at most MAX_TEMPLATES templates, and renders
+// other opcodes uncached
+TEST(TestTextCache, TestBound) {
+  SH::TextCache cache;
+  size_t decoded = 0;
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    SH::DecodedInsn insn;
+    if (!SH::DecodeInstruction(SH::SH_2E_ISA, opcode, 0x1000, insn)) {
+      continue;
+    }
+    decoded++;
+    size_t len = INSTRUCTION_SIZE;
+    std::vector<BN::InstructionTextToken> want, got;
+    ASSERT_TRUE(SH::DispatchText(insn, 0x1000, len, want));
+    ASSERT_TRUE(cache.Render(insn, 0x1000, len, got));
+    EXPECT_EQ(tokens_to_string(got), tokens_to_string(want));
+  }
+  ASSERT_GT(decoded, SH::TextCache::MAX_TEMPLATES);
+  EXPECT_EQ(cache.Size(), SH::TextCache::MAX_TEMPLATES);
+}
+
+// Test that an architecture created for GNU syntax renders it
+TEST(TestTextCache, TestSyntax) {
+  const auto arch =
+      std::make_unique<SH::SH2EArchitecture>("shgnu", SH::Syntax::GNU);
+  const std::array<uint8_t, 2> bytes = {0x51, 0x42};
+  size_t len = bytes.size();
+  std::vector<BN::InstructionTextToken> tokens;
+  ASSERT_TRUE(arch->GetInstructionText(bytes.data(), 0x1000, len, tokens));
+  EXPECT_EQ(tokens_to_string(tokens), "mov.l\t@(8,r4),r1");
+  EXPECT_EQ(arch->syntax, SH::Syntax::GNU);
+}
+
+// Test that plain text renders exactly the text of the instruction tokens in
+// each syntax, which are as many as TokenCount reserves
+TEST(TestRenderText, TestMatchesTokens) {
+  for (const auto isa : {SH::SH_1_ISA, SH::SH_2E_ISA, SH::SH_DSP_ISA}) {
+    for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+      SH::DecodedInsn insn;
+      if (!SH::DecodeInstruction(isa, opcode, 0x8000fffe, insn)) {
+        continue;
+      }
+      size_t len = INSTRUCTION_SIZE;
+      std::vector<BN::InstructionTextToken> tokens;
+      ASSERT_TRUE(SH::DispatchText(insn, 0x8000fffe, len, tokens));
+      EXPECT_EQ(tokens.size(), SH::TokenCount(insn.id))
+          << "opcode 0x" << std::hex << opcode;
+      EXPECT_EQ(tokens.capacity(), tokens.size());
+
+      std::array<char, SH::MAX_RENDERED_LENGTH> text;
+      const size_t n = SH::RenderText(insn, text);
+      ASSERT_NE(n, 0);
+      EXPECT_EQ(std::string_view(text.data(), n), tokens_to_string(tokens))
+          << "opcode 0x" << std::hex << opcode;
+
+      std::vector<BN::InstructionTextToken> gnu;
+      ASSERT_TRUE(
+          SH::DispatchText<SH::GnuSyntax>(insn, 0x8000fffe, len, gnu));
+      const size_t gnu_n =
+          SH::RenderText(insn, text, {.syntax = SH::Syntax::GNU});
+      ASSERT_NE(gnu_n, 0);
+      EXPECT_EQ(std::string_view(text.data(), gnu_n), tokens_to_string(gnu))
+          << "opcode 0x" << std::hex << opcode;
+    }
+  }
+}
+
+// Test the lowercase and GNU as renderings of a few operand forms
+TEST(TestRenderText, TestSyntax) {
+  const auto render = [](const uint16_t opcode, const SH::RenderOptions opts) {
+    SH::DecodedInsn insn;
+    EXPECT_TRUE(SH::DecodeInstruction(SH::SH_2E_ISA, opcode, 0x1000, insn));
+    std::array<char, SH::MAX_RENDERED_LENGTH> text;
+    return std::string(text.data(), SH::RenderText(insn, text, opts));
+  };
+  const SH::RenderOptions lower{.lowercase = true};
+  const SH::RenderOptions gnu{.syntax = SH::Syntax::GNU};
+
+  EXPECT_EQ(render(0x5142, {}), "MOV.L @(0x2,R4),R1");
+  EXPECT_EQ(render(0x5142, lower), "mov.l @(0x2,r4),r1");
+  EXPECT_EQ(render(0x5142, gnu), "mov.l\t@(8,r4),r1");
+  EXPECT_EQ(render(0xE1FF, {}), "MOV #0xff,R1");
+  EXPECT_EQ(render(0xE1FF, gnu), "mov\t#-1,r1");
+  EXPECT_EQ(render(0xC9FF, gnu), "and\t#255,r0");
+  EXPECT_EQ(render(0xD103, {}), "MOV.L @0x1010,R1");
+  EXPECT_EQ(render(0xD103, gnu), "mov.l\t0x1010,r1");
+  EXPECT_EQ(render(0xC703, {}), "MOVA #0x1010,R0");
+  EXPECT_EQ(render(0x8BFE, gnu), "bf\t0x1000");
+  EXPECT_EQ(render(0xF10C, gnu), "fmov\tfr0,fr1");
+  EXPECT_EQ(render(0x000B, gnu), "rts");
+
+  // Too small a buffer writes nothing
+  SH::DecodedInsn insn;
+  ASSERT_TRUE(SH::DecodeInstruction(SH::SH_2E_ISA, 0x5142, 0x1000, insn));
+  std::array<char, 8> small;
+  EXPECT_EQ(SH::RenderText(insn, small), 0);
+}
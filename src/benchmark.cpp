@@ -0,0 +1,261 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <binaryninjaapi.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "allocation_counter.h"
+#include "architecture.h"
+#include "branches.h"
+#include "classifier.h"
+#include "density.h"
+#include "instructions.h"
+#include "listing.h"
+#include "render.h"
+
+namespace BN = BinaryNinja;
+namespace SH = SuperH;
+
+// Every opcode in big-endian order, as a linear sweep over a 128 KB image
+static std::vector<uint8_t> AllOpcodes() {
+  std::vector<uint8_t> bytes(2 * 0x10000);
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    bytes[2 * opcode] = opcode >> 8;
+    bytes[2 * opcode + 1] = opcode & 0xFF;
+  }
+  return bytes;
+}
+
+// A short function, with its pool, repeated over a 128 KB image as a stand-in
+// for a listing of typical code
+static std::vector<uint8_t> Listing() {
+  constexpr std::array<uint16_t, 16> function = {
+      0x2FE6, 0x4F22, 0x6EF3, 0xD103, 0xE405, 0x410B, 0x6543, 0x8800,
+      0x8B02, 0x7401, 0x6242, 0x622C, 0x4F26, 0x000B, 0x6EF6, 0x0009,
+  };
+  std::vector<uint8_t> bytes(2 * 0x10000);
+  for (size_t i = 0; i < 0x10000; i++) {
+    bytes[2 * i] = function[i % function.size()] >> 8;
+    bytes[2 * i + 1] = function[i % function.size()] & 0xFF;
+  }
+  return bytes;
+}
+
+// Runs `body` over the image until at least a second has passed and reports
+// the rate in millions of halfwords per second
+template <class F>
+static void Measure(const char *arch, const char *name, F body) {
+  using Clock = std::chrono::steady_clock;
+  constexpr size_t halfwords = 0x10000;
+
+  body();  // warm up tables and caches
+  size_t rounds = 0;
+  const auto start = Clock::now();
+  auto elapsed = std::chrono::duration<double>(0);
+  while (elapsed.count() < 1.0) {
+    body();
+    rounds++;
+    elapsed = Clock::now() - start;
+  }
+
+  const double rate = rounds * halfwords / elapsed.count();
+  std::printf("%-6s %-14s %10.2f M/s %10.2f MB/s\n", arch, name, rate / 1e6,
+              rate * INSTRUCTION_SIZE / 1e6);
+}
+
+// The Info, Text and Lift callbacks each decode the instruction at an
+// address, so decode each one that many times: straight from the decode
+// table, and through the decode cache that the callbacks use
+template <SH::IsaType ISA>
+static void MeasureDecodeCache(const char *name,
+                               const std::vector<uint8_t> &bytes,
+                               size_t &sink) {
+  constexpr int callbacks = 3;
+  SH::DecodedInsn insn{};
+  Measure(name, "decode x3", [&] {
+    for (size_t i = 0; i < bytes.size(); i += INSTRUCTION_SIZE) {
+      const uint16_t opcode = bytes[i] << 8 | bytes[i + 1];
+      for (int c = 0; c < callbacks; c++) {
+        sink += SH::DecodeInstruction<ISA>(opcode, i, insn) != nullptr;
+      }
+    }
+  });
+
+  SH::DecodeCache cache;
+  Measure(name, "decode x3 cache", [&] {
+    for (size_t i = 0; i < bytes.size(); i += INSTRUCTION_SIZE) {
+      const uint16_t opcode = bytes[i] << 8 | bytes[i + 1];
+      for (int c = 0; c < callbacks; c++) {
+        sink += cache.Decode<ISA>(opcode, i, insn) != nullptr;
+      }
+    }
+  });
+}
+
+static void Run(const char *name, SH::Architecture &arch) {
+  const auto bytes = AllOpcodes();
+  const auto isa = arch.isa_type;
+  size_t sink = 0;  // keeps the results live
+  // The decode cache counts lookups of every architecture
+  const auto hits = SH::DecodeCache::GetHits();
+  const auto misses = SH::DecodeCache::GetMisses();
+
+  Measure(name, "decode", [&] {
+    SH::DecodedInsn insn{};
+    for (size_t i = 0; i < bytes.size(); i += INSTRUCTION_SIZE) {
+      const uint16_t opcode = bytes[i] << 8 | bytes[i + 1];
+      sink += SH::DecodeInstruction(isa, opcode, i, insn) != nullptr;
+    }
+  });
+
+  if (isa == SH::SH_1_ISA) {
+    MeasureDecodeCache<SH::SH_1_ISA>(name, bytes, sink);
+  } else {
+    MeasureDecodeCache<SH::SH_2E_ISA>(name, bytes, sink);
+  }
+
+  SH::DecodedRange range;
+  Measure(name, "decode range", [&] {
+    sink += SH::DecodeRange(isa, bytes.data(), bytes.size(), 0, range);
+  });
+
+  std::vector<SH::BranchEdge> edges;
+  Measure(name, "branch edges", [&] {
+    sink += SH::FindBranchEdges(isa, bytes.data(), bytes.size(), 0, edges);
+  });
+
+  std::vector<float> scores;
+  Measure(name, "code density", [&] {
+    sink += SH::ScoreCodeDensity(isa, bytes.data(), bytes.size(), 256, 64,
+                                 scores);
+  });
+
+  Measure(name, "classify", [&] {
+    const auto labels =
+        SH::ClassifyImage(isa, bytes.data(), bytes.size(), 0, 1);
+    sink += labels[0] == SH::Label::CODE;
+  });
+
+  Measure(name, "info", [&] {
+    for (size_t i = 0; i < bytes.size(); i += INSTRUCTION_SIZE) {
+      BN::InstructionInfo result;
+      sink += arch.GetInstructionInfo(bytes.data() + i, i,
+                                      bytes.size() - i, result);
+    }
+  });
+
+  std::vector<BN::InstructionTextToken> tokens;
+  Measure(name, "text", [&] {
+    for (size_t i = 0; i < bytes.size(); i += INSTRUCTION_SIZE) {
+      size_t len = bytes.size() - i;
+      tokens.clear();
+      sink += arch.GetInstructionText(bytes.data() + i, i, len, tokens);
+    }
+  });
+
+  const auto listing = Listing();
+  Measure(name, "text listing", [&] {
+    for (size_t i = 0; i < listing.size(); i += INSTRUCTION_SIZE) {
+      size_t len = listing.size() - i;
+      tokens.clear();
+      sink += arch.GetInstructionText(listing.data() + i, i, len, tokens);
+    }
+  });
+
+  Measure(name, "text uncached", [&] {
+    SH::DecodedInsn insn{};
+    for (size_t i = 0; i < listing.size(); i += INSTRUCTION_SIZE) {
+      size_t len = listing.size() - i;
+      const uint16_t opcode = listing[i] << 8 | listing[i + 1];
+      tokens.clear();
+      if (SH::DecodeInstruction(isa, opcode, i, insn)) {
+        sink += SH::DispatchText(insn, i, len, tokens);
+      }
+    }
+  });
+
+  std::vector<char> text(bytes.size() / INSTRUCTION_SIZE *
+                         (SH::MAX_RENDERED_LENGTH + 1));
+  const auto render = [&](const SH::RenderOptions options) {
+    SH::DecodedInsn insn{};
+    char *out = text.data();
+    for (size_t i = 0; i < bytes.size(); i += INSTRUCTION_SIZE) {
+      const uint16_t opcode = bytes[i] << 8 | bytes[i + 1];
+      if (SH::DecodeInstruction(isa, opcode, i, insn)) {
+        out += SH::RenderText(insn, {out, SH::MAX_RENDERED_LENGTH}, options);
+        *out++ = '\n';
+      }
+    }
+    sink += out - text.data();
+  };
+  Measure(name, "render", [&] { render({}); });
+  Measure(name, "render gnu", [&] { render({.syntax = SH::Syntax::GNU}); });
+
+  std::ostringstream listing_out;
+  Measure(name, "listing", [&] {
+    const auto read = [&](const uint64_t addr, uint8_t *dest,
+                          const size_t len) {
+      std::copy_n(bytes.data() + addr, len, dest);
+      return len;
+    };
+    SH::ListingStats stats;
+    listing_out.str({});
+    sink += SH::WriteListing(isa, BigEndian, {{0, bytes.size()}}, read,
+                             listing_out, {}, nullptr, stats);
+  });
+
+  // Heap allocations per instruction rendered by `render`, into the warm
+  // vector above so that only the tokens' own strings count, or into a new
+  // vector per call as Binary Ninja passes
+  const auto count_allocations = [&](const bool fresh, auto render) {
+    const size_t before = SH::AllocationCount();
+    size_t rendered = 0;
+    for (size_t i = 0; i < bytes.size(); i += INSTRUCTION_SIZE) {
+      std::vector<BN::InstructionTextToken> result;
+      tokens.clear();
+      rendered += render(i, fresh ? result : tokens);
+    }
+    sink += rendered;
+    return static_cast<double>(SH::AllocationCount() - before) /
+           static_cast<double>(rendered);
+  };
+  const auto cached = [&](const size_t i, auto &result) {
+    size_t len = bytes.size() - i;
+    return arch.GetInstructionText(bytes.data() + i, i, len, result);
+  };
+  const auto uncached = [&](const size_t i, auto &result) {
+    SH::DecodedInsn insn{};
+    size_t len = bytes.size() - i;
+    const uint16_t opcode = bytes[i] << 8 | bytes[i + 1];
+    return SH::DecodeInstruction(isa, opcode, i, insn) &&
+           SH::DispatchText(insn, i, len, result);
+  };
+  std::printf("%-6s text allocations: %.2f warm, %.2f new vector, %.2f "
+              "uncached per instruction\n",
+              name, count_allocations(false, cached),
+              count_allocations(true, cached),
+              count_allocations(true, uncached));
+
+  std::printf(
+      "%-6s decode cache: %llu hits, %llu misses\n", name,
+      static_cast<unsigned long long>(SH::DecodeCache::GetHits() - hits),
+      static_cast<unsigned long long>(SH::DecodeCache::GetMisses() - misses));
+}
+
+int main() {
+  std::printf("%-6s %-14s %14s %15s\n", "ISA", "benchmark", "halfwords",
+              "throughput");
+
+  const auto sh1 = std::make_unique<SH::SH1Architecture>("shbench1");
+  Run("SH-1", *sh1);
+  const auto sh2e = std::make_unique<SH::SH2EArchitecture>("shbench2e");
+  Run("SH-2E", *sh2e);
+  return 0;
+}
@@ -0,0 +1,153 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "branches.h"
+
+#include <array>
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include "spec.h"
+
+namespace SuperH {
+// BT and BF are 10001001 and 10001011; BT/S and BF/S also set bit 10
+constexpr uint16_t CONDITIONAL = 0x8900;
+constexpr uint16_t CONDITIONAL_MASK = 0xF900;
+constexpr uint16_t CONDITIONAL_NO_SLOT_MASK = 0xFD00;
+
+// BRA and BSR are 1010 and 1011, so their top three bits are 101
+constexpr uint16_t LONG_TOP = 0b101;
+
+// Edge for a direct branch at `source`, given its displacement in bytes
+static BranchEdge Edge(const uint16_t opcode, const int16_t disp,
+                       const uint32_t source) {
+  static constexpr InsnId CONDITIONAL_IDS[] = {
+      InsnId::BtDisp, InsnId::BfDisp, InsnId::BtsDisp, InsnId::BfsDisp};
+  const auto id = opcode >> 12 == 0xA   ? InsnId::BraDisp
+                  : opcode >> 12 == 0xB ? InsnId::BsrDisp
+                                        : CONDITIONAL_IDS[(opcode >> 9) & 3];
+  return {source, source + 2 * INSTRUCTION_SIZE + disp, id,
+          PROPERTIES[static_cast<size_t>(id)].branch};
+}
+
+#if defined(__AVX2__)
+constexpr size_t LANES = 16;
+#elif defined(__SSE2__) || defined(_M_X64) || \
+    (defined(__ARM_NEON) && defined(__aarch64__))
+constexpr size_t LANES = 8;
+#else
+constexpr size_t LANES = 0;
+#endif
+
+/*
+ * Classifies the LANES big-endian halfwords at `data` at once. Stores them in
+ * host order with their displacements, sign-extended from 8 or 12 bits and
+ * scaled to bytes, and returns a mask with two bits set for each lane holding
+ * a direct branch (the layout of a byte movemask).
+ */
+[[maybe_unused]] static uint32_t ScanBlock(const uint8_t *data,
+                                           const uint16_t conditional_mask,
+                                           uint16_t *opcodes, int16_t *disps) {
+#if defined(__AVX2__)
+  const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+  const auto op =
+      _mm256_or_si256(_mm256_slli_epi16(v, 8), _mm256_srli_epi16(v, 8));
+  const auto is_long = _mm256_cmpeq_epi16(_mm256_srli_epi16(op, 13),
+                                          _mm256_set1_epi16(LONG_TOP));
+  const auto is_conditional = _mm256_cmpeq_epi16(
+      _mm256_and_si256(op, _mm256_set1_epi16(conditional_mask)),
+      _mm256_set1_epi16(static_cast<int16_t>(CONDITIONAL)));
+  const auto d12 = _mm256_srai_epi16(_mm256_slli_epi16(op, 4), 4);
+  const auto d8 = _mm256_srai_epi16(_mm256_slli_epi16(op, 8), 8);
+  const auto disp = _mm256_slli_epi16(_mm256_blendv_epi8(d8, d12, is_long), 1);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(opcodes), op);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(disps), disp);
+  return _mm256_movemask_epi8(_mm256_or_si256(is_long, is_conditional));
+#elif defined(__SSE2__) || defined(_M_X64)
+  const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+  const auto op = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+  const auto is_long =
+      _mm_cmpeq_epi16(_mm_srli_epi16(op, 13), _mm_set1_epi16(LONG_TOP));
+  const auto is_conditional =
+      _mm_cmpeq_epi16(_mm_and_si128(op, _mm_set1_epi16(conditional_mask)),
+                      _mm_set1_epi16(static_cast<int16_t>(CONDITIONAL)));
+  const auto d12 = _mm_srai_epi16(_mm_slli_epi16(op, 4), 4);
+  const auto d8 = _mm_srai_epi16(_mm_slli_epi16(op, 8), 8);
+  const auto disp = _mm_slli_epi16(
+      _mm_or_si128(_mm_and_si128(is_long, d12), _mm_andnot_si128(is_long, d8)),
+      1);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(opcodes), op);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(disps), disp);
+  return _mm_movemask_epi8(_mm_or_si128(is_long, is_conditional));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  static constexpr uint16_t LANE_BITS[] = {3 << 0,  3 << 2,  3 << 4,  3 << 6,
+                                           3 << 8,  3 << 10, 3 << 12, 3 << 14};
+  const auto op = vreinterpretq_u16_u8(vrev16q_u8(vld1q_u8(data)));
+  const auto is_long = vceqq_u16(vshrq_n_u16(op, 13), vdupq_n_u16(LONG_TOP));
+  const auto is_conditional =
+      vceqq_u16(vandq_u16(op, vdupq_n_u16(conditional_mask)),
+                vdupq_n_u16(CONDITIONAL));
+  const auto s = vreinterpretq_s16_u16(op);
+  const auto d12 = vshrq_n_s16(vshlq_n_s16(s, 4), 4);
+  const auto d8 = vshrq_n_s16(vshlq_n_s16(s, 8), 8);
+  const auto disp = vshlq_n_s16(vbslq_s16(is_long, d12, d8), 1);
+  vst1q_u16(opcodes, op);
+  vst1q_s16(disps, disp);
+  return vaddvq_u16(
+      vandq_u16(vorrq_u16(is_long, is_conditional), vld1q_u16(LANE_BITS)));
+#else
+  return 0;
+#endif
+}
+
+size_t FindBranchEdges(const IsaType &t, const uint8_t *data, const size_t len,
+                       const uint64_t base, std::vector<BranchEdge> &out) {
+  const size_t count = len / INSTRUCTION_SIZE;
+  const auto source = static_cast<uint32_t>(base);
+  const uint16_t conditional_mask =
+      SPECS[static_cast<size_t>(InsnId::BtsDisp)].Supports(t)
+          ? CONDITIONAL_MASK
+          : CONDITIONAL_NO_SLOT_MASK;
+  out.clear();
+
+  size_t i = 0;
+  if constexpr (LANES > 0) {
+    std::array<uint16_t, LANES> opcodes;
+    std::array<int16_t, LANES> disps;
+    for (; i + LANES <= count; i += LANES) {
+      auto mask = ScanBlock(data + INSTRUCTION_SIZE * i, conditional_mask,
+                            opcodes.data(), disps.data());
+      // Branches are sparse, so most blocks end here
+      while (mask != 0) {
+        const auto lane = std::countr_zero(mask) / 2;
+        mask &= ~(3u << (2 * lane));
+        out.push_back(Edge(opcodes[lane], disps[lane],
+                           source + INSTRUCTION_SIZE * (i + lane)));
+      }
+    }
+  }
+
+  for (; i < count; i++) {
+    const auto opcode =
+        static_cast<uint16_t>(data[2 * i] << 8 | data[2 * i + 1]);
+    int16_t disp;
+    if (opcode >> 13 == LONG_TOP) {
+      disp = static_cast<int16_t>(static_cast<int16_t>(opcode << 4) >> 4);
+    } else if ((opcode & conditional_mask) == CONDITIONAL) {
+      disp = static_cast<int8_t>(opcode & 0xFF);
+    } else {
+      continue;
+    }
+    out.push_back(Edge(opcode, static_cast<int16_t>(2 * disp),
+                       source + INSTRUCTION_SIZE * i));
+  }
+  return out.size();
+}
+}  // namespace SuperH
@@ -0,0 +1,34 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_BRANCHES_H_
+#define SRC_BRANCHES_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "instructions.h"
+#include "properties.h"
+
+namespace SuperH {
+// A direct branch or call from the instruction at `source` to `target`
+struct BranchEdge {
+  uint32_t source;
+  uint32_t target;
+  InsnId id;  // BtDisp, BfDisp, BtsDisp, BfsDisp, BraDisp or BsrDisp
+  BranchKind kind;
+};
+
+/*
+ * Finds every direct branch and call (BT, BF, BT/S, BF/S, BRA and BSR) among
+ * the big-endian halfwords in the `len` bytes at `data`, which are loaded at
+ * `base`, and replaces the contents of `out` with their edges in address
+ * order. Every halfword is treated as a potential instruction, so edges from
+ * data are included; callers seeding analysis should filter them. A trailing
+ * odd byte is ignored. Returns the number of edges found.
+ */
+size_t FindBranchEdges(const IsaType &t, const uint8_t *data, size_t len,
+                       uint64_t base, std::vector<BranchEdge> &out);
+}  // namespace SuperH
+
+#endif  // SRC_BRANCHES_H_
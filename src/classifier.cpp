@@ -0,0 +1,266 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "classifier.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <thread>
+
+#include "opcodes.h"
+#include "properties.h"
+
+namespace SuperH {
+// Halfwords labelled per task; a multiple of four so that chunks never share
+// a byte of the LabelMap
+constexpr size_t CHUNK = 1 << 16;
+
+// Halfwords either side whose scores are summed to label one
+constexpr size_t RADIUS = 8;
+// Shortest run of 0x0000 or 0xFFFF labelled padding
+constexpr size_t MIN_FILL = 8;
+// Most NOPs after a return or jump labelled alignment padding
+constexpr size_t MAX_ALIGN = 8;
+// Context decoded either side of a chunk, which covers all of the above
+constexpr size_t MARGIN = 2 * RADIUS;
+static_assert(MARGIN > RADIUS && MARGIN >= MIN_FILL && MARGIN > MAX_ALIGN + 1);
+
+// Scores are log-likelihood ratios in fixed point, so that sums over a
+// window are exact and do not depend on how the buffer was chunked
+constexpr int32_t SCALE = 16;
+constexpr int32_t INVALID_SCORE = -4 * SCALE;
+constexpr int32_t SLOT_PENALTY = -4 * SCALE;
+
+// Rough share of each opcode family (top nibble) in compiled SH code
+constexpr std::array<double, 16> CODE_MIX = {
+    0.06,  // 0000 RTS, NOP, MOV.x @(R0,Rm), STS
+    0.04,  // 0001 MOV.L Rm,@(disp,Rn)
+    0.10,  // 0010 MOV.x stores, TST, AND, OR, XOR
+    0.07,  // 0011 CMP/xx, ADD, SUB
+    0.10,  // 0100 shifts, JSR, JMP, LDS.L/STS.L, DT
+    0.06,  // 0101 MOV.L @(disp,Rm),Rn
+    0.16,  // 0110 MOV Rm,Rn, loads, EXTU, NEG
+    0.06,  // 0111 ADD #imm
+    0.06,  // 1000 BT, BF, MOV.x @(disp,Rm), CMP/EQ #imm
+    0.03,  // 1001 MOV.W @(disp,PC)
+    0.03,  // 1010 BRA
+    0.02,  // 1011 BSR
+    0.03,  // 1100 GBR-relative, MOVA, TRAPA, #imm logic
+    0.08,  // 1101 MOV.L @(disp,PC)
+    0.07,  // 1110 MOV #imm
+    0.03,  // 1111 floating point
+};
+
+// Rough factor by which a family is more likely right after another in
+// compiled SH code than CODE_MIX alone predicts; 1 for pairs not listed
+struct FamilyPair {
+  uint8_t prev;
+  uint8_t next;
+  double lift;
+};
+
+constexpr std::array<FamilyPair, 10> CODE_PAIRS = {{
+    {0x3, 0x8, 3.0},  // CMP/xx, then BT or BF
+    {0x2, 0x8, 2.5},  // TST, then BT or BF
+    {0x8, 0x8, 1.5},  // CMP/EQ #imm, then BT or BF
+    {0xD, 0x4, 2.0},  // MOV.L @(disp,PC) of an address, then JSR or JMP
+    {0x4, 0x6, 1.5},  // JSR, then a MOV in its delay slot
+    {0x0, 0x6, 1.5},  // RTS, then a MOV.L @R15+ in its delay slot
+    {0x2, 0x4, 1.5},  // MOV.L Rm,@-R15 pushes, then STS.L PR,@-R15
+    {0x4, 0x4, 1.5},  // LDS.L/STS.L and shifts in runs
+    {0x6, 0x6, 1.3},  // MOV Rm,Rn and loads in runs
+    {0xE, 0xE, 1.3},  // MOV #imm in runs
+}};
+
+// Row of FamilyTable for a halfword whose predecessor is unknown or invalid
+constexpr size_t NO_PREVIOUS = 16;
+
+// Score of each family, indexed by the family of the preceding halfword
+using FamilyTable = std::array<std::array<int32_t, 16>, NO_PREVIOUS + 1>;
+
+// Score of a valid opcode in each family after each family:
+// log(P(family | previous, code) / P(family | random bytes)). The code mix,
+// scaled by CODE_PAIRS and restricted to families the ISA has, is normalized
+// for every previous family. The NO_PREVIOUS row uses CODE_MIX alone.
+static FamilyTable FamilyScores(const OpcodeBitmap &valid) {
+  std::array<size_t, 16> counts{};
+  for (size_t w = 0; w < valid.size(); w++) {
+    counts[w / (valid.size() / 16)] += std::popcount(valid[w]);
+  }
+
+  FamilyTable scores{};
+  for (size_t prev = 0; prev <= NO_PREVIOUS; prev++) {
+    std::array<double, 16> mix = CODE_MIX;
+    for (const auto &pair : CODE_PAIRS) {
+      if (pair.prev == prev) {
+        mix[pair.next] *= pair.lift;
+      }
+    }
+    double total = 0;
+    for (size_t f = 0; f < 16; f++) {
+      total += counts[f] != 0 ? mix[f] : 0;
+    }
+
+    for (size_t f = 0; f < 16; f++) {
+      const double code = mix[f] / total;
+      const double random = static_cast<double>(counts[f]) / 0x10000;
+      scores[prev][f] = counts[f] == 0
+                            ? INVALID_SCORE
+                            : static_cast<int32_t>(
+                                  std::lround(SCALE * std::log(code / random)));
+    }
+  }
+  return scores;
+}
+
+static bool IsFill(const uint16_t opcode) {
+  return opcode == 0x0000 || opcode == 0xFFFF;
+}
+
+// A return or jump whose delay slot may be followed by alignment padding
+static bool EndsBlock(const uint8_t id) {
+  if (id == DecodedRange::INVALID) {
+    return false;
+  }
+  const auto &props = PROPERTIES[id];
+  return props.delay_slot && (props.branch == BranchKind::JUMP ||
+                              props.branch == BranchKind::RETURN);
+}
+
+// A PC-relative load from code, recorded to label its constant afterwards
+struct PoolLoad {
+  size_t index;  // halfword of the constant
+  uint8_t halfwords;
+};
+
+static void ClassifyChunk(const IsaType &t, const FamilyTable &families,
+                          const uint8_t *data, const size_t count,
+                          const uint64_t base, const size_t begin,
+                          const size_t end, LabelMap &labels,
+                          std::vector<PoolLoad> &loads) {
+  const size_t lo = begin >= MARGIN ? begin - MARGIN : 0;
+  const size_t hi = std::min(count, end + MARGIN);
+  DecodedRange range;
+  const size_t n = DecodeRange(t, data + INSTRUCTION_SIZE * lo,
+                               INSTRUCTION_SIZE * (hi - lo),
+                               base + INSTRUCTION_SIZE * lo, range);
+  const auto &ops = range.opcodes;
+  const auto &ids = range.ids;
+
+  // Prefix sums of the scores, and the length of the run of fill ending at
+  // and starting at each halfword
+  std::vector<int32_t> sums(n + 1);
+  std::vector<uint8_t> fill_before(n), fill_after(n);
+  for (size_t i = 0; i < n; i++) {
+    int32_t score = INVALID_SCORE;
+    if (ids[i] != DecodedRange::INVALID) {
+      const bool after_valid = i > 0 && ids[i - 1] != DecodedRange::INVALID;
+      const size_t prev = after_valid ? ops[i - 1] >> 12 : NO_PREVIOUS;
+      score = families[prev][ops[i] >> 12];
+      if (after_valid && PROPERTIES[ids[i - 1]].delay_slot &&
+          PROPERTIES[ids[i]].illegal_in_slot) {
+        score += SLOT_PENALTY;
+      }
+    }
+    sums[i + 1] = sums[i] + score;
+
+    if (IsFill(ops[i])) {
+      const bool run = i > 0 && ops[i - 1] == ops[i];
+      fill_before[i] = run ? std::min<size_t>(fill_before[i - 1] + 1, MIN_FILL)
+                           : 1;
+    }
+  }
+  for (size_t i = n; i-- > 0;) {
+    if (IsFill(ops[i])) {
+      const bool run = i + 1 < n && ops[i + 1] == ops[i];
+      fill_after[i] = run ? std::min<size_t>(fill_after[i + 1] + 1, MIN_FILL)
+                          : 1;
+    }
+  }
+
+  // Alignment NOPs follow the delay slot of a return or jump, which may
+  // itself be a NOP
+  const auto is_alignment = [&](const size_t k) {
+    if (ops[k] != Opcodes::Nop) {
+      return false;
+    }
+    size_t first = k;
+    while (first > 0 && k - first < MAX_ALIGN &&
+           ops[first - 1] == Opcodes::Nop) {
+      first--;
+    }
+    if (first > 0 && EndsBlock(ids[first - 1])) {
+      return k > first;
+    }
+    return first > 1 && ops[first - 1] != Opcodes::Nop &&
+           EndsBlock(ids[first - 2]);
+  };
+
+  for (size_t j = begin; j < end; j++) {
+    const size_t k = j - lo;
+    const size_t from = k >= RADIUS ? k - RADIUS : 0;
+    const size_t to = std::min(n, k + RADIUS + 1);
+    auto label = sums[to] - sums[from] > 0 ? Label::CODE : Label::DATA;
+    if ((IsFill(ops[k]) && fill_before[k] + fill_after[k] > MIN_FILL) ||
+        is_alignment(k)) {
+      label = Label::PADDING;
+    }
+    labels.Set(j, label);
+
+    if (label == Label::CODE && (range.flags[k] & DecodedInsn::PC_RELATIVE)) {
+      // The constant is a short way forward, so only the low 32 bits of the
+      // address are needed to find it even when `base` is wider
+      const uint64_t addr = base + INSTRUCTION_SIZE * j;
+      const uint32_t offset = range.targets[k] - static_cast<uint32_t>(addr);
+      const size_t index = j + offset / INSTRUCTION_SIZE;
+      const auto id = static_cast<InsnId>(ids[k]);
+      if (id == InsnId::MovwIndrDispPcRn) {
+        loads.push_back({index, 1});
+      } else if (id == InsnId::MovlIndrDispPcRn) {
+        loads.push_back({index, 2});
+      }
+    }
+  }
+}
+
+LabelMap ClassifyImage(const IsaType &t, const uint8_t *data, const size_t len,
+                       const uint64_t base, unsigned threads) {
+  const size_t count = len / INSTRUCTION_SIZE;
+  const size_t chunks = (count + CHUNK - 1) / CHUNK;
+  const auto families = FamilyScores(GetValidOpcodes(t));
+  LabelMap labels(count);
+  std::vector<std::vector<PoolLoad>> loads(chunks);
+
+  std::atomic<size_t> next{0};
+  const auto worker = [&] {
+    for (size_t c; (c = next.fetch_add(1)) < chunks;) {
+      ClassifyChunk(t, families, data, count, base, c * CHUNK,
+                    std::min(count, (c + 1) * CHUNK), labels, loads[c]);
+    }
+  };
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  std::vector<std::thread> workers;
+  for (size_t i = 1; i < std::min<size_t>(threads, chunks); i++) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (auto &w : workers) {
+    w.join();
+  }
+
+  // Constants may be loaded from another chunk, so label them last
+  for (const auto &chunk : loads) {
+    for (const auto &load : chunk) {
+      for (size_t h = 0; h < load.halfwords && load.index + h < count; h++) {
+        labels.Set(load.index + h, Label::POOL);
+      }
+    }
+  }
+  return labels;
+}
+}  // namespace SuperH
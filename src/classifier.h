@@ -0,0 +1,64 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_CLASSIFIER_H_
+#define SRC_CLASSIFIER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "instructions.h"
+
+namespace SuperH {
+enum class Label : uint8_t {
+  DATA,
+  CODE,
+  POOL,     // constant loaded by a PC-relative MOV.W or MOV.L
+  PADDING,  // alignment NOPs after a return or jump, or erased/zeroed fill
+};
+
+// One Label per halfword, packed four to a byte
+class LabelMap {
+ public:
+  explicit LabelMap(const size_t count)
+      : packed((count + 3) / 4), count(count) {}
+
+  Label operator[](const size_t i) const {
+    return static_cast<Label>((packed[i / 4] >> (2 * (i % 4))) & 3);
+  }
+
+  void Set(const size_t i, const Label label) {
+    auto &byte = packed[i / 4];
+    byte = (byte & ~(3 << (2 * (i % 4)))) |
+           static_cast<uint8_t>(label) << (2 * (i % 4));
+  }
+
+  [[nodiscard]] size_t size() const { return count; }
+
+ private:
+  std::vector<uint8_t> packed;
+  size_t count;
+};
+
+/*
+ * Labels every big-endian halfword in the `len` bytes at `data`, which are
+ * loaded at `base`, as code, data, literal pool or padding. A trailing odd
+ * byte is ignored.
+ *
+ * Each halfword is scored by how much more likely its opcode class (its top
+ * nibble, the families in opcodes.h) is in compiled code than in random
+ * bytes, given the class of the halfword before it, with penalties for
+ * undefined opcodes and for instructions that are illegal in the delay slot
+ * of the preceding branch. Scores are summed over a
+ * small window, so isolated valid opcodes in data and odd halfwords in code
+ * do not flip the label. Padding and the targets of PC-relative loads from
+ * code are then labelled on top.
+ *
+ * The buffer is split into chunks labelled on `threads` threads (0 for one
+ * per core); the result does not depend on the number of threads.
+ */
+LabelMap ClassifyImage(const IsaType &t, const uint8_t *data, size_t len,
+                       uint64_t base, unsigned threads = 0);
+}  // namespace SuperH
+
+#endif  // SRC_CLASSIFIER_H_
@@ -0,0 +1,112 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_DECODE_CACHE_H_
+#define SRC_DECODE_CACHE_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "instructions.h"
+
+namespace SuperH {
+/*
+ * Cache of recently decoded instructions, so that the Info, Text and Lift
+ * callbacks for one address (and repeat visits during re-analysis) decode it
+ * only once.
+ *
+ * Binary Ninja calls the architecture from many analysis threads, so each
+ * thread owns a small direct-mapped table and lookups never lock. Entries are
+ * keyed by address, opcode and ISA, so patched bytes or a different
+ * architecture at the same address simply miss. The hit and miss counts are
+ * kept per thread too, and summed over every cache when read.
+ */
+class DecodeCache {
+ public:
+  static constexpr size_t ENTRIES = 1024;  // per thread; a power of two
+
+  // Same contract as DecodeInstruction<ISA>(opcode, addr, insn)
+  template <IsaType ISA>
+  const Instruction *Decode(const uint16_t opcode, const uint64_t addr,
+                            DecodedInsn &insn) {
+    auto &entry = entries[(addr / INSTRUCTION_SIZE) & (ENTRIES - 1)];
+    if (entry.instruction != nullptr && entry.addr == addr &&
+        entry.insn.opcode == opcode && entry.isa_type == ISA) {
+      // Entries are filled only after a miss on this thread, which
+      // registered its counters
+      Count(counters->hits);
+      insn = entry.insn;
+      return entry.instruction;
+    }
+
+    if (counters == nullptr) [[unlikely]] {
+      counters = Register();
+    }
+    Count(counters->misses);
+    const auto i = DecodeInstruction<ISA>(opcode, addr, insn);
+    if (i != nullptr) {
+      entry = Entry{addr, i, insn, ISA};
+    }
+    return i;
+  }
+
+  // Lookups by every cache on every thread
+  [[nodiscard]] static uint64_t GetHits() { return Sum(&Counters::hits); }
+
+  [[nodiscard]] static uint64_t GetMisses() { return Sum(&Counters::misses); }
+
+ private:
+  struct Entry {
+    uint64_t addr;
+    const Instruction *instruction;  // nullptr for an empty entry
+    DecodedInsn insn;
+    IsaType isa_type;
+  };
+
+  /*
+   * Lookup counts of one thread. Only that thread writes them, so counting
+   * never contends for a cache line. They are allocated and registered on
+   * the thread's first miss and never freed, so that the counts of exited
+   * threads still add up; that is 16 bytes per thread that ever decoded.
+   */
+  struct Counters {
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+  };
+
+  static Counters *Register() {
+    auto *added = new Counters();
+    const std::lock_guard lock(registry_mutex);
+    registry.push_back(added);
+    return added;
+  }
+
+  // A plain increment; a read-modify-write is not needed with one writer
+  static void Count(std::atomic<uint64_t> &counter) {
+    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
+  }
+
+  static uint64_t Sum(std::atomic<uint64_t> Counters::*counter) {
+    const std::lock_guard lock(registry_mutex);
+    uint64_t total = 0;
+    for (const auto *thread : registry) {
+      total += (thread->*counter).load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  // Shared by every cache on a thread; entries from another ISA never match.
+  // Both are constant-initialized, so reaching them needs no guard check.
+  static inline thread_local std::array<Entry, ENTRIES> entries{};
+  static inline thread_local Counters *counters = nullptr;
+
+  static inline std::mutex registry_mutex;
+  static inline std::vector<Counters *> registry;
+};
+}  // namespace SuperH
+
+#endif  // SRC_DECODE_CACHE_H_
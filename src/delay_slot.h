@@ -0,0 +1,97 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_DELAY_SLOT_H_
+#define SRC_DELAY_SLOT_H_
+
+#include <binaryninjaapi.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#include "decode_cache.h"
+#include "fetch.h"
+#include "instructions.h"
+#include "properties.h"
+
+namespace SuperH {
+/*
+ * An instruction decoded together with its delay slot, when it has one. The
+ * register, memory and T bit effects are the union of both instructions.
+ */
+struct DecodedPair {
+  const Instruction *instruction;
+  const Instruction *slot;  // nullptr without a decodable slot
+  DecodedInsn insn;
+  DecodedInsn slot_insn;
+  size_t length;      // bytes covered, 4 when the slot was decoded
+  bool has_slot;      // the instruction executes a delay slot
+  bool slot_illegal;  // the slot is undefined or illegal in a delay slot
+  bool reads_t;
+  bool writes_t;
+  uint8_t mem_width;  // widest memory access of the two, or 0
+  uint64_t reads;
+  uint64_t writes;
+};
+
+/*
+ * Decodes the instruction at `data` and, if it is a delayed branch and `len`
+ * covers it, the instruction in its slot, both through `cache` so that later
+ * callbacks for either address reuse them. Returns false if the first
+ * instruction is undefined.
+ */
+template <IsaType ISA, BNEndianness ENDIAN>
+bool DecodePair(DecodeCache &cache, const uint8_t *data, const size_t len,
+                const uint64_t addr, DecodedPair &pair) {
+  if (len < INSTRUCTION_SIZE) {
+    return false;
+  }
+  pair.instruction =
+      cache.Decode<ISA>(FetchOpcode<ENDIAN>(data), addr, pair.insn);
+  if (pair.instruction == nullptr) {
+    return false;
+  }
+
+  const auto &props = PropertiesOf(pair.insn);
+  pair.slot = nullptr;
+  pair.slot_insn = DecodedInsn{};
+  pair.length = INSTRUCTION_SIZE;
+  pair.has_slot = props.delay_slot;
+  pair.slot_illegal = false;
+  pair.reads_t = props.reads_t;
+  pair.writes_t = props.writes_t;
+  pair.mem_width = props.mem_width;
+  pair.reads = RegistersRead(pair.insn);
+  pair.writes = RegistersWritten(pair.insn);
+  if (!pair.has_slot || len < 2 * INSTRUCTION_SIZE) {
+    return true;
+  }
+
+  pair.length = 2 * INSTRUCTION_SIZE;
+  pair.slot = cache.Decode<ISA>(FetchOpcode<ENDIAN>(data + INSTRUCTION_SIZE),
+                                addr + INSTRUCTION_SIZE, pair.slot_insn);
+  if (pair.slot == nullptr) {
+    pair.slot_illegal = true;
+    return true;
+  }
+
+  const auto &slot_props = PropertiesOf(pair.slot_insn);
+  pair.slot_illegal = slot_props.illegal_in_slot;
+  pair.reads_t |= slot_props.reads_t;
+  pair.writes_t |= slot_props.writes_t;
+  pair.mem_width = std::max(pair.mem_width, slot_props.mem_width);
+  pair.reads |= RegistersRead(pair.slot_insn);
+  pair.writes |= RegistersWritten(pair.slot_insn);
+  return true;
+}
+
+/*
+ * Lifts the instruction of `pair` and, for a delayed branch, its slot, which
+ * runs after the branch reads its operands and before control transfers.
+ * Sets `len` to the bytes lifted: 4 for a branch with its slot, else 2.
+ */
+bool LiftPair(const DecodedPair &pair, uint64_t addr, size_t &len,
+              BN::LowLevelILFunction &il, BN::Architecture *arch);
+}  // namespace SuperH
+
+#endif  // SRC_DELAY_SLOT_H_
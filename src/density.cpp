@@ -0,0 +1,75 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "density.h"
+
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace SuperH {
+/*
+ * Sets bit i % 64 of bits[i / 64] when halfword i of `data` is a valid
+ * opcode. AVX2 builds look up eight opcodes at a time with a gather from the
+ * bitmap viewed as 32-bit words.
+ */
+static void ValidBits(const OpcodeBitmap &bitmap, const uint8_t *data,
+                      const size_t count, uint64_t *bits) {
+  size_t i = 0;
+#if defined(__AVX2__)
+  const auto words = reinterpret_cast<const int *>(bitmap.data());
+  for (; i + 8 <= count; i += 8) {
+    const auto v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 2 * i));
+    const auto op = _mm256_cvtepu16_epi32(
+        _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+    const auto word =
+        _mm256_i32gather_epi32(words, _mm256_srli_epi32(op, 5), 4);
+    const auto bit =
+        _mm256_srlv_epi32(word, _mm256_and_si256(op, _mm256_set1_epi32(31)));
+    const auto valid = static_cast<uint64_t>(
+        _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_slli_epi32(bit, 31))));
+    bits[i / 64] |= valid << (i % 64);
+  }
+#endif
+  for (; i < count; i++) {
+    const auto op = static_cast<uint16_t>(data[2 * i] << 8 | data[2 * i + 1]);
+    bits[i / 64] |= ((bitmap[op / 64] >> (op % 64)) & 1) << (i % 64);
+  }
+}
+
+size_t ScoreCodeDensity(const IsaType &t, const uint8_t *data, const size_t len,
+                        const size_t window, const size_t step,
+                        std::vector<float> &out) {
+  const size_t count = len / INSTRUCTION_SIZE;
+  out.clear();
+  if (window == 0 || step == 0 || count < window) {
+    return 0;
+  }
+
+  // One spare word so that the rank of `count` never reads past the end
+  const size_t words = count / 64 + 1;
+  std::vector<uint64_t> bits(words);
+  ValidBits(GetValidOpcodes(t), data, count, bits.data());
+
+  // Valid opcodes before each word, so any window is counted with two
+  // lookups and two popcounts
+  std::vector<uint32_t> ranks(words);
+  for (size_t w = 1; w < words; w++) {
+    ranks[w] = ranks[w - 1] + std::popcount(bits[w - 1]);
+  }
+  const auto rank = [&](const size_t i) {
+    const auto below = (uint64_t{1} << (i % 64)) - 1;
+    return ranks[i / 64] + std::popcount(bits[i / 64] & below);
+  };
+
+  out.reserve((count - window) / step + 1);
+  for (size_t start = 0; start + window <= count; start += step) {
+    out.push_back(static_cast<float>(rank(start + window) - rank(start)) /
+                  static_cast<float>(window));
+  }
+  return out.size();
+}
+}  // namespace SuperH
@@ -0,0 +1,26 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_DENSITY_H_
+#define SRC_DENSITY_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "instructions.h"
+
+namespace SuperH {
+/*
+ * Fraction of the big-endian halfwords in the `len` bytes at `data` that are
+ * valid opcodes for the ISA, in windows of `window` halfwords starting every
+ * `step` halfwords. Code scores near 1 and most data well below it, which
+ * makes this a cheap filter for regions of a raw dump that are not worth
+ * disassembling. Replaces the contents of `out` with one score per window
+ * and returns the number of windows, which is zero when the buffer is shorter
+ * than one window.
+ */
+size_t ScoreCodeDensity(const IsaType &t, const uint8_t *data, size_t len,
+                        size_t window, size_t step, std::vector<float> &out);
+}  // namespace SuperH
+
+#endif  // SRC_DENSITY_H_
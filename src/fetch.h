@@ -0,0 +1,31 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_FETCH_H_
+#define SRC_FETCH_H_
+
+#include <binaryninjaapi.h>
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+namespace SuperH {
+// Reads the opcode at `data` stored in the byte order ENDIAN. Compiles to a
+// single load, plus a byte swap when ENDIAN differs from the host.
+template <BNEndianness ENDIAN>
+uint16_t FetchOpcode(const uint8_t *data) {
+  static_assert(ENDIAN == BigEndian || ENDIAN == LittleEndian);
+  constexpr auto order =
+      ENDIAN == BigEndian ? std::endian::big : std::endian::little;
+
+  uint16_t opcode;
+  std::memcpy(&opcode, data, sizeof(opcode));
+  if constexpr (order != std::endian::native) {
+    opcode = static_cast<uint16_t>(opcode << 8 | opcode >> 8);
+  }
+  return opcode;
+}
+}  // namespace SuperH
+
+#endif  // SRC_FETCH_H_
@@ -0,0 +1,58 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_HEX_H_
+#define SRC_HEX_H_
+
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace SuperH {
+// Text of an 8-bit immediate as printf's "%#hhx" renders it
+struct ImmediateText {
+  std::array<char, 4> text;
+  uint8_t length;
+};
+
+constexpr std::array<ImmediateText, 256> MakeImmediateTexts() {
+  constexpr std::string_view digits = "0123456789abcdef";
+  std::array<ImmediateText, 256> texts{};
+  texts[0] = {{'0'}, 1};
+  for (size_t i = 1; i < texts.size(); i++) {
+    auto &[text, length] = texts[i];
+    text[length++] = '0';
+    text[length++] = 'x';
+    if (i >= 0x10) {
+      text[length++] = digits[i >> 4];
+    }
+    text[length++] = digits[i & 0xF];
+  }
+  return texts;
+}
+
+inline constexpr auto IMMEDIATE_TEXTS = MakeImmediateTexts();
+
+// "0" for zero, otherwise e.g. "0x7f"
+constexpr std::string_view FormatImmediate(const uint8_t imm) {
+  const auto &[text, length] = IMMEDIATE_TEXTS[imm];
+  return {text.data(), length};
+}
+
+// Formats an address with a 0x prefix even when it is zero, e.g. "0x0"
+inline std::string FormatAddress(const uint64_t value) {
+  char buf[2 + 16] = {'0', 'x'};
+  const auto end = std::to_chars(buf + 2, buf + sizeof(buf), value, 16).ptr;
+  return {buf, end};
+}
+
+// Formats `value` as printf's "%#lx" does: "0" for zero, otherwise e.g.
+// "0x3c"
+inline std::string FormatHex(const uint64_t value) {
+  return value == 0 ? "0" : FormatAddress(value);
+}
+}  // namespace SuperH
+
+#endif  // SRC_HEX_H_
@@ -6,8 +6,10 @@
 
 #include <binaryninjaapi.h>
 
+#include <array>
 #include <cstdint>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "sizes.h"
@@ -19,6 +21,236 @@ namespace BN = BinaryNinja;
 namespace SuperH {
 enum IsaType { SH_1_ISA, SH_2E_ISA, SH_DSP_ISA };
 
+// Every decodable instruction class, in the order of SPECS. InsnId and Visit
+// are both expanded from this list, so each id names the class of the same
+// name, and spec.h checks that SPECS has one entry per id in this order.
+#define SUPERH_INSTRUCTIONS(X)      \
+  X(Clrt)                           \
+  X(Nop)                            \
+  X(Rts)                            \
+  X(Sett)                           \
+  X(Div0u)                          \
+  X(Sleep)                          \
+  X(Clrmac)                         \
+  X(Rte)                            \
+  X(StcSrRn)                        \
+  X(BsrfRm)                         \
+  X(StsMachRn)                      \
+  X(StcGbrRn)                       \
+  X(StsMaclRn)                      \
+  X(StcVbrRn)                       \
+  X(BrafRm)                         \
+  X(MovtRn)                         \
+  X(StsPrRn)                        \
+  X(StsFpulRn)                      \
+  X(StsFpscrRn)                     \
+  X(MovbRmIndrR0Rn)                 \
+  X(MovwRmIndrR0Rn)                 \
+  X(MovlRmIndrR0Rn)                 \
+  X(MullRmRn)                       \
+  X(MovbIndrR0RmRn)                 \
+  X(MovwIndrR0RmRn)                 \
+  X(MovlIndrR0RmRn)                 \
+  X(MaclIndrRmPostincIndrRnPostinc) \
+  X(MovlRmIndrDispRn)               \
+  X(MovbRmIndrRn)                   \
+  X(MovwRmIndrRn)                   \
+  X(MovlRmIndrRn)                   \
+  X(MovbRmIndrPredecRn)             \
+  X(MovwRmIndrPredecRn)             \
+  X(MovlRmIndrPredecRn)             \
+  X(Div0sRmRn)                      \
+  X(TstRmRn)                        \
+  X(AndRmRn)                        \
+  X(XorRmRn)                        \
+  X(OrRmRn)                         \
+  X(CmpStrRmRn)                     \
+  X(XtrctRmRn)                      \
+  X(MuluwRmRn)                      \
+  X(MulswRmRn)                      \
+  X(CmpEqRmRn)                      \
+  X(CmpHsRmRn)                      \
+  X(CmpGeRmRn)                      \
+  X(Div1RmRn)                       \
+  X(DmululRmRn)                     \
+  X(CmpHiRmRn)                      \
+  X(CmpGtRmRn)                      \
+  X(SubRmRn)                        \
+  X(SubcRmRn)                       \
+  X(SubvRmRn)                       \
+  X(AddRmRn)                        \
+  X(DmulslRmRn)                     \
+  X(AddcRmRn)                       \
+  X(AddvRmRn)                       \
+  X(ShllRn)                         \
+  X(ShlrRn)                         \
+  X(StslMachIndrPredecRn)           \
+  X(StclSrIndrPredecRn)             \
+  X(RotlRn)                         \
+  X(RotrRn)                         \
+  X(LdslIndrRmPostincMach)          \
+  X(LdclIndrRmPostincSr)            \
+  X(Shll2Rn)                        \
+  X(Shlr2Rn)                        \
+  X(LdsRmMach)                      \
+  X(JsrIndrRm)                      \
+  X(LdcRmSr)                        \
+  X(DtRn)                           \
+  X(CmpPzRn)                        \
+  X(StslMaclIndrPredecRn)           \
+  X(StclGbrIndrPredecRn)            \
+  X(CmpPlRn)                        \
+  X(LdslIndrRmPostincMacl)          \
+  X(LdclIndrRmPostincGbr)           \
+  X(Shll8Rn)                        \
+  X(Shlr8Rn)                        \
+  X(LdsRmMacl)                      \
+  X(TasbIndrRn)                     \
+  X(LdcRmGbr)                       \
+  X(ShalRn)                         \
+  X(SharRn)                         \
+  X(StslPrIndrPredecRn)             \
+  X(StclVbrIndrPredecRn)            \
+  X(RotclRn)                        \
+  X(RotcrRn)                        \
+  X(LdslIndrRmPostincPr)            \
+  X(LdclIndrRmPostincVbr)           \
+  X(Shll16Rn)                       \
+  X(Shlr16Rn)                       \
+  X(LdsRmPr)                        \
+  X(JmpIndrRm)                      \
+  X(LdcRmVbr)                       \
+  X(StslFpulIndrPredecRn)           \
+  X(LdslIndrRmPostincFpul)          \
+  X(LdsRmFpul)                      \
+  X(StslFpscrIndrPredecRn)          \
+  X(LdslIndrRmPostincFpscr)         \
+  X(LdsRmFpscr)                     \
+  X(MacwIndrRmPostincIndrRnPostinc) \
+  X(MovlIndrDispRmRn)               \
+  X(MovbIndrRmRn)                   \
+  X(MovwIndrRmRn)                   \
+  X(MovlIndrRmRn)                   \
+  X(MovRmRn)                        \
+  X(MovbIndrRmPostincRn)            \
+  X(MovwIndrRmPostincRn)            \
+  X(MovlIndrRmPostincRn)            \
+  X(NotRmRn)                        \
+  X(SwapbRmRn)                      \
+  X(SwapwRmRn)                      \
+  X(NegcRmRn)                       \
+  X(NegRmRn)                        \
+  X(ExtubRmRn)                      \
+  X(ExtuwRmRn)                      \
+  X(ExtsbRmRn)                      \
+  X(ExtswRmRn)                      \
+  X(AddImmRn)                       \
+  X(MovbR0IndrDispRn)               \
+  X(MovwR0IndrDispRn)               \
+  X(MovbIndrDispRmR0)               \
+  X(MovwIndrDispRmR0)               \
+  X(CmpEqImmR0)                     \
+  X(BtDisp)                         \
+  X(BfDisp)                         \
+  X(BtsDisp)                        \
+  X(BfsDisp)                        \
+  X(MovwIndrDispPcRn)               \
+  X(BraDisp)                        \
+  X(BsrDisp)                        \
+  X(MovbR0IndrDispGbr)              \
+  X(MovwR0IndrDispGbr)              \
+  X(MovlR0IndrDispGbr)              \
+  X(TrapaImm)                       \
+  X(MovbIndrDispGbrR0)              \
+  X(MovwIndrDispGbrR0)              \
+  X(MovlIndrDispGbrR0)              \
+  X(MovaIndrDispPcR0)               \
+  X(TstImmR0)                       \
+  X(AndImmR0)                       \
+  X(XorImmR0)                       \
+  X(OrImmR0)                        \
+  X(TstbImmIndrR0Gbr)               \
+  X(AndbImmIndrR0Gbr)               \
+  X(XorbImmIndrR0Gbr)               \
+  X(OrbImmIndrR0Gbr)                \
+  X(MovlIndrDispPcRn)               \
+  X(MovImmRn)                       \
+  X(FstsFpulFrn)                    \
+  X(FldsFrmFpul)                    \
+  X(FloatFpulFrn)                   \
+  X(FtrcFrmFpul)                    \
+  X(FnegFrn)                        \
+  X(FabsFrn)                        \
+  X(Fldi0Frn)                       \
+  X(Fldi1Frn)                       \
+  X(FaddFrmFrn)                     \
+  X(FsubFrmFrn)                     \
+  X(FmulFrmFrn)                     \
+  X(FdivFrmFrn)                     \
+  X(FcmpEqFrmFrn)                   \
+  X(FcmpGtFrmFrn)                   \
+  X(FmovsIndrR0RmFrn)               \
+  X(FmovsFrmIndrR0Rn)               \
+  X(FmovsIndrRmFrn)                 \
+  X(FmovsIndrRmPostincFrn)          \
+  X(FmovsFrmIndrRn)                 \
+  X(FmovsFrmIndrPredecRn)           \
+  X(FmovFrmFrn)                     \
+  X(FmacFr0FrmFrn)
+
+// Dense id of every decodable instruction class, in the order of SPECS
+enum class InsnId : uint8_t {
+#define SUPERH_INSN_ID(name) name,
+  SUPERH_INSTRUCTIONS(SUPERH_INSN_ID)
+#undef SUPERH_INSN_ID
+};
+
+#define SUPERH_INSN_COUNT(name) +1
+inline constexpr size_t INSN_COUNT = 0 SUPERH_INSTRUCTIONS(SUPERH_INSN_COUNT);
+#undef SUPERH_INSN_COUNT
+
+/*
+ * Operands of a decoded instruction. Fields are extracted, sign-extended and
+ * scaled once by DecodeInstruction and then shared by the Info, Text and Lift
+ * methods.
+ */
+struct DecodedInsn {
+  enum Flags : uint8_t {
+    PC_RELATIVE = 1 << 0,  // `target` holds a resolved PC-relative address
+  };
+
+  uint32_t target;  // resolved branch target or PC-relative load address
+  int32_t imm;      // displacement in bytes, or (sign-extended) immediate
+  uint16_t opcode;
+  uint16_t raw;  // displacement or immediate field exactly as encoded
+  InsnId id;     // also the index into SPECS
+  uint8_t n;
+  uint8_t m;
+  uint8_t flags;
+};
+
+static_assert(sizeof(DecodedInsn) == 16);
+static_assert(std::is_trivially_copyable_v<DecodedInsn>);
+
+/*
+ * Struct-of-arrays form of DecodedInsn for a run of consecutive halfwords,
+ * filled by DecodeRange. Entry i describes the halfword at base + 2 * i.
+ * Reusing one DecodedRange across calls avoids reallocating its arrays.
+ */
+struct DecodedRange {
+  static constexpr uint8_t INVALID = 0xFF;  // id of an undefined opcode
+
+  std::vector<uint16_t> opcodes;
+  std::vector<uint8_t> ids;  // index into SPECS, or INVALID
+  std::vector<uint8_t> n;
+  std::vector<uint8_t> m;
+  std::vector<uint8_t> flags;
+  std::vector<int32_t> imm;
+  std::vector<uint32_t> targets;  // resolved PC-relative address, or 0
+
+  [[nodiscard]] size_t size() const { return ids.size(); }
+};
+
 /*
  * Text format methods
  */
@@ -28,144 +260,130 @@ struct RegTextInfo {
   int64_t disp;
 };
 
-static void GenerateRegisterTokens(
-    std::vector<BN::InstructionTextToken> &result, RegTextInfo rti);
+template <class SYNTAX, class OUT>
+void GenerateRegisterTokens(OUT &result, RegTextInfo rti);
 
-static void generateImmText(std::vector<BN::InstructionTextToken> &result,
-                            uint8_t imm8);
+template <class SYNTAX, class OUT>
+void generateImmText(OUT &result, const DecodedInsn &insn);
 
-static void Text0Format(std::vector<BN::InstructionTextToken> &result,
-                        const std::string &instr);
+template <class SYNTAX, class OUT>
+void Text0Format(const DecodedInsn &insn, OUT &result);
 
-static void TextNFormatDstRn(uint16_t opcode,
-                             std::vector<BN::InstructionTextToken> &result,
-                             const std::string &instr, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNFormatDstRn(const DecodedInsn &insn, OUT &result, bool fp = false);
 
-static void TextNFormatDstIndrRn(uint16_t opcode,
-                                 std::vector<BN::InstructionTextToken> &result,
-                                 const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextNFormatDstIndrRn(const DecodedInsn &insn, OUT &result);
 
-static void TextNFormatSrcCtrlSysRegDstRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, uint32_t ctrl_sys_reg, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNFormatSrcCtrlSysRegDstRn(const DecodedInsn &insn, OUT &result,
+                                   uint32_t ctrl_sys_reg, bool fp = false);
 
-static void TextNFormatSrcRmDstCtrlSysReg(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, uint32_t ctrl_sys_reg, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNFormatSrcRmDstCtrlSysReg(const DecodedInsn &insn, OUT &result,
+                                   uint32_t ctrl_sys_reg, bool fp = false);
 
-static void TextNFormatSrcIndrPostincRmDstCtrlSysReg(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, uint32_t ctrl_sys_reg, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNFormatSrcIndrPostincRmDstCtrlSysReg(const DecodedInsn &insn,
+                                              OUT &result,
+                                              uint32_t ctrl_sys_reg,
+                                              bool fp = false);
 
-static void TextNFormatSrcCtrlSysRegDstIndrPredecRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, uint32_t ctrl_sys_reg, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNFormatSrcCtrlSysRegDstIndrPredecRn(const DecodedInsn &insn,
+                                             OUT &result, uint32_t ctrl_sys_reg,
+                                             bool fp = false);
 
-static void TextMFormatSrcRmDstCtrlSysReg(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, uint32_t ctrl_sys_reg);
+template <class SYNTAX, class OUT>
+void TextMFormatSrcRmDstCtrlSysReg(const DecodedInsn &insn, OUT &result,
+                                   uint32_t ctrl_sys_reg);
 
-static void TextMFormatSrcIndrPostincRmDstCtrlSysReg(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, uint32_t ctrl_sys_reg);
+template <class SYNTAX, class OUT>
+void TextMFormatSrcIndrPostincRmDstCtrlSysReg(const DecodedInsn &insn,
+                                              OUT &result,
+                                              uint32_t ctrl_sys_reg);
 
-static void TextMFormatSrcIndrRm(uint16_t opcode,
-                                 std::vector<BN::InstructionTextToken> &result,
-                                 const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextMFormatSrcIndrRm(const DecodedInsn &insn, OUT &result);
 
-static void TextMFormatSrcPCrelRm(uint16_t opcode,
-                                  std::vector<BN::InstructionTextToken> &result,
-                                  const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextMFormatSrcPCrelRm(const DecodedInsn &insn, OUT &result);
 
-static void TextNMFormatSrcRmDstRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcRmDstRn(const DecodedInsn &insn, OUT &result,
+                            bool fp = false);
 
-static void TextNMFormatFR0FRmFRn(uint16_t opcode,
-                                  std::vector<BN::InstructionTextToken> &result,
-                                  const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextNMFormatFR0FRmFRn(const DecodedInsn &insn, OUT &result);
 
-static void TextNMFormatSrcRmDstIndrRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcRmDstIndrRn(const DecodedInsn &insn, OUT &result,
+                                bool fp = false);
 
-static void TextNMFormatSrcIndrRmDstRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcIndrRmDstRn(const DecodedInsn &insn, OUT &result,
+                                bool fp = false);
 
-void TextNMFormatSrcIndrPostincRmRnDstMAC(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcIndrPostincRmRnDstMAC(const DecodedInsn &insn, OUT &result);
 
-void TextNMFormatSrcIndrPostincRmDstRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcIndrPostincRmDstRn(const DecodedInsn &insn, OUT &result,
+                                       bool fp = false);
 
-void TextNMFormatSrcRmDstIndrPredecRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcRmDstIndrPredecRn(const DecodedInsn &insn, OUT &result,
+                                      bool fp = false);
 
-void TextNMFormatSrcRmDstIndrIdxRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcRmDstIndrIdxRn(const DecodedInsn &insn, OUT &result,
+                                   bool fp = false);
 
-void TextNMFormatSrcIndrIdxRmDstRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, bool fp = false);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcIndrIdxRmDstRn(const DecodedInsn &insn, OUT &result,
+                                   bool fp = false);
 
-void TextMDFormatSrcIndrDispRmDstR0(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextMDFormatSrcIndrDispRmDstR0(const DecodedInsn &insn, OUT &result);
 
-void TextND4FormatSrcR0DstIndrDispRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextND4FormatSrcR0DstIndrDispRn(const DecodedInsn &insn, OUT &result);
 
-void TextNMDFormatSrcRmDstIndrDispRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextNMDFormatSrcRmDstIndrDispRn(const DecodedInsn &insn, OUT &result);
 
-void TextNMDFormatSrcIndrDispRmDstRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextNMDFormatSrcIndrDispRmDstRn(const DecodedInsn &insn, OUT &result);
 
-void TextDFormatSrcIndrGBRDispDstR0(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextDFormatSrcIndrGBRDispDstR0(const DecodedInsn &insn, OUT &result);
 
-void TextDFormatSrcR0DstIndrGBRDisp(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextDFormatSrcR0DstIndrGBRDisp(const DecodedInsn &insn, OUT &result);
 
-void MOVATextDFormatSrcIndrPCrelDispDstR0(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, uint64_t addr);
+template <class SYNTAX, class OUT>
+void MOVATextDFormatSrcIndrPCrelDispDstR0(const DecodedInsn &insn, OUT &result);
 
-void TextDFormatSrcPCrel(std::vector<BN::InstructionTextToken> &result,
-                         const std::string &instr, uint32_t target);
+template <class SYNTAX, class OUT>
+void TextDFormatSrcPCrel(const DecodedInsn &insn, OUT &result);
 
-void TextD12FormatSrcPCrel(std::vector<BN::InstructionTextToken> &result,
-                           const std::string &instr, uint32_t target);
+template <class SYNTAX, class OUT>
+void TextD12FormatSrcPCrel(const DecodedInsn &insn, OUT &result);
 
-void MOVWLTextND8FormatSrcPCrelDispDstRn(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, size_t size, uint64_t addr);
+template <class SYNTAX, class OUT>
+void MOVWLTextND8FormatSrcPCrelDispDstRn(const DecodedInsn &insn, OUT &result);
 
-void TextIFormatSrcImmDstIndrIdxGBR(
-    uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextIFormatSrcImmDstIndrIdxGBR(const DecodedInsn &insn, OUT &result);
 
-void TextIFormatSrcImmDstR0(uint16_t opcode,
-                            std::vector<BN::InstructionTextToken> &result,
-                            const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextIFormatSrcImmDstR0(const DecodedInsn &insn, OUT &result);
 
-void TextIFormatSrcImm(uint16_t opcode,
-                       std::vector<BN::InstructionTextToken> &result,
-                       const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextIFormatSrcImm(const DecodedInsn &insn, OUT &result);
 
-void TextNIFormatSrcImmDstRn(uint16_t opcode,
-                             std::vector<BN::InstructionTextToken> &result,
-                             const std::string &instr);
+template <class SYNTAX, class OUT>
+void TextNIFormatSrcImmDstRn(const DecodedInsn &insn, OUT &result);
 
 /*
  * Abstract instruction class that all instructions must use.
@@ -173,53 +391,66 @@ void TextNIFormatSrcImmDstRn(uint16_t opcode,
  * be generic.
  */
 class Instruction {
-  IsaType isa_type;
-
  public:
   virtual ~Instruction() = default;
-  explicit Instruction(const IsaType &t);
 
   static constexpr size_t length = Sizes::WORD;
 
-  virtual bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) = 0;
+  // Each class also has a Text method template taking a syntax policy (see
+  // syntax.h), reached through DispatchText
 
-  virtual bool Info(uint16_t opcode, uint64_t addr,
-                    BN::InstructionInfo &result);
+  virtual bool Info(const DecodedInsn &insn, uint64_t addr,
+                    BN::InstructionInfo &result) const;
 
-  virtual bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-                    BN::LowLevelILFunction &il, BN::Architecture *arch);
-
-  [[nodiscard]] IsaType GetIsaType()
-      const;  // can be used by each method to make isa-specific decisions
+  virtual bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                    BN::LowLevelILFunction &il, BN::Architecture *arch) const;
 };
 
-std::optional<std::unique_ptr<Instruction>> DecodeInstruction(const IsaType &t,
-                                                              uint16_t opcode);
+// Returns a shared, immutable instance of the instruction class that matches
+// `opcode`, or nullptr if the opcode is not a valid instruction. Decoding never
+// allocates and is a single lookup in a dense per-ISA table.
+const Instruction *DecodeInstruction(const IsaType &t, uint16_t opcode);
+
+// As above, and also fills `insn` with the operands of the instruction at
+// `addr` for the Info, Text and Lift methods.
+const Instruction *DecodeInstruction(const IsaType &t, uint16_t opcode,
+                                     uint64_t addr, DecodedInsn &insn);
 
-std::optional<std::unique_ptr<Instruction>> ParsePrefix0000(const IsaType &t,
-                                                            uint16_t opcode);
+// As above for an ISA fixed at compile time, which skips selecting the table.
+// Instantiated for every IsaType.
+template <IsaType ISA>
+const Instruction *DecodeInstruction(uint16_t opcode, uint64_t addr,
+                                     DecodedInsn &insn);
 
-std::optional<std::unique_ptr<Instruction>> ParsePrefix0010(const IsaType &t,
-                                                            uint16_t opcode);
+// Bit `opcode % 64` of word `opcode / 64` is set for every opcode that
+// decodes for the ISA; 8 KB per ISA
+using OpcodeBitmap = std::array<uint64_t, 0x10000 / 64>;
 
-std::optional<std::unique_ptr<Instruction>> ParsePrefix0011(const IsaType &t,
-                                                            uint16_t opcode);
+const OpcodeBitmap &GetValidOpcodes(const IsaType &t);
 
-std::optional<std::unique_ptr<Instruction>> ParsePrefix0100(const IsaType &t,
-                                                            uint16_t opcode);
+// Decodes every big-endian halfword in the `len` bytes at `data`, which are
+// loaded at `base`, into `out`. A trailing odd byte is ignored. Returns the
+// number of halfwords decoded.
+size_t DecodeRange(const IsaType &t, const uint8_t *data, size_t len,
+                   uint64_t base, DecodedRange &out);
 
-std::optional<std::unique_ptr<Instruction>> ParsePrefix0110(const IsaType &t,
-                                                            uint16_t opcode);
+// Run the Text, Info or Lift method of the instruction decoded into `insn`
+// without a virtual call. Each is a switch over InsnId in the file that
+// defines those methods, so the compiler can inline them. DispatchText is
+// instantiated for RenesasSyntax and GnuSyntax, writing either tokens or a
+// TextWriter (see render.h), and defaults to Renesas tokens.
+template <class SYNTAX, class OUT>
+bool DispatchText(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                  OUT &result);
 
-std::optional<std::unique_ptr<Instruction>> ParsePrefix1000(const IsaType &t,
-                                                            uint16_t opcode);
+bool DispatchText(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                  std::vector<BN::InstructionTextToken> &result);
 
-std::optional<std::unique_ptr<Instruction>> ParsePrefix1100(const IsaType &t,
-                                                            uint16_t opcode);
+bool DispatchInfo(const DecodedInsn &insn, uint64_t addr,
+                  BN::InstructionInfo &result);
 
-std::optional<std::unique_ptr<Instruction>> ParsePrefix1111(const IsaType &t,
-                                                            uint16_t opcode);
+bool DispatchLift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                  BN::LowLevelILFunction &il, BN::Architecture *arch);
 
 /*
  * Concrete classes for CPU instructions that should be returned from
@@ -227,1856 +458,1698 @@ std::optional<std::unique_ptr<Instruction>> ParsePrefix1111(const IsaType &t,
  */
 class AddRmRn final : public Instruction {
  public:
-  explicit AddRmRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class AddImmRn final : public Instruction {
  public:
-  explicit AddImmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class AddcRmRn final : public Instruction {
  public:
-  explicit AddcRmRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class AddvRmRn final : public Instruction {
  public:
-  explicit AddvRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class AndRmRn final : public Instruction {
  public:
-  explicit AndRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class AndImmR0 final : public Instruction {
  public:
-  explicit AndImmR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class AndbImmIndrR0Gbr final : public Instruction {
  public:
-  explicit AndbImmIndrR0Gbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class BfDisp final : public Instruction {
  public:
-  explicit BfDisp(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
-
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class BfsDisp final : public Instruction {
  public:
-  explicit BfsDisp(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  // TODO: Lift
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class BraDisp final : public Instruction {
  public:
-  explicit BraDisp(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
-
-  // TODO: Lift
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class BrafRm final : public Instruction {
  public:
-  explicit BrafRm(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
-
-  // TODO: Lift
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class BsrDisp final : public Instruction {
  public:
-  explicit BsrDisp(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
-
-  // TODO: Lift
-
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class BsrfRm final : public Instruction {
  public:
-  explicit BsrfRm(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  // TODO: Lift
-
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class BtDisp final : public Instruction {
  public:
-  explicit BtDisp(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
-
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class BtsDisp final : public Instruction {
  public:
-  explicit BtsDisp(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
-
-  // TODO: Lift
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class Clrmac final : public Instruction {
  public:
-  explicit Clrmac(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Clrt final : public Instruction {
  public:
-  explicit Clrt(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class CmpEqRmRn final : public Instruction {
  public:
-  explicit CmpEqRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class CmpGeRmRn final : public Instruction {
  public:
-  explicit CmpGeRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class CmpGtRmRn final : public Instruction {
  public:
-  explicit CmpGtRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class CmpHiRmRn final : public Instruction {
  public:
-  explicit CmpHiRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class CmpHsRmRn final : public Instruction {
  public:
-  explicit CmpHsRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class CmpPlRn final : public Instruction {
  public:
-  explicit CmpPlRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class CmpPzRn final : public Instruction {
  public:
-  explicit CmpPzRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class CmpStrRmRn final : public Instruction {
  public:
-  explicit CmpStrRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class CmpEqImmR0 final : public Instruction {
  public:
-  explicit CmpEqImmR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Div0sRmRn final : public Instruction {
  public:
-  explicit Div0sRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Div0u final : public Instruction {
  public:
-  explicit Div0u(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Div1RmRn final : public Instruction {
  public:
-  explicit Div1RmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class DmulslRmRn final : public Instruction {
  public:
-  explicit DmulslRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class DmululRmRn final : public Instruction {
  public:
-  explicit DmululRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class DtRn final : public Instruction {
  public:
-  explicit DtRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class ExtsbRmRn final : public Instruction {
  public:
-  explicit ExtsbRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class ExtswRmRn final : public Instruction {
  public:
-  explicit ExtswRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class ExtubRmRn final : public Instruction {
  public:
-  explicit ExtubRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class ExtuwRmRn final : public Instruction {
  public:
-  explicit ExtuwRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FabsFrn final : public Instruction {
  public:
-  explicit FabsFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FaddFrmFrn final : public Instruction {
  public:
-  explicit FaddFrmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FcmpEqFrmFrn final : public Instruction {
  public:
-  explicit FcmpEqFrmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FcmpGtFrmFrn final : public Instruction {
  public:
-  explicit FcmpGtFrmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FdivFrmFrn final : public Instruction {
  public:
-  explicit FdivFrmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Fldi0Frn final : public Instruction {
  public:
-  explicit Fldi0Frn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Fldi1Frn final : public Instruction {
  public:
-  explicit Fldi1Frn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FldsFrmFpul final : public Instruction {
  public:
-  explicit FldsFrmFpul(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FloatFpulFrn final : public Instruction {
  public:
-  explicit FloatFpulFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FmacFr0FrmFrn final : public Instruction {
  public:
-  explicit FmacFr0FrmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FmovFrmFrn final : public Instruction {
  public:
-  explicit FmovFrmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FmovsIndrR0RmFrn final : public Instruction {
  public:
-  explicit FmovsIndrR0RmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FmovsIndrRmPostincFrn final : public Instruction {
  public:
-  explicit FmovsIndrRmPostincFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FmovsIndrRmFrn final : public Instruction {
  public:
-  explicit FmovsIndrRmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FmovsFrmIndrR0Rn final : public Instruction {
  public:
-  explicit FmovsFrmIndrR0Rn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FmovsFrmIndrPredecRn final : public Instruction {
  public:
-  explicit FmovsFrmIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FmovsFrmIndrRn final : public Instruction {
  public:
-  explicit FmovsFrmIndrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FmulFrmFrn final : public Instruction {
  public:
-  explicit FmulFrmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FnegFrn final : public Instruction {
  public:
-  explicit FnegFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FstsFpulFrn final : public Instruction {
  public:
-  explicit FstsFpulFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FsubFrmFrn final : public Instruction {
  public:
-  explicit FsubFrmFrn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class FtrcFrmFpul final : public Instruction {
  public:
-  explicit FtrcFrmFpul(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdsRmFpscr final : public Instruction {
  public:
-  explicit LdsRmFpscr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdsRmFpul final : public Instruction {
  public:
-  explicit LdsRmFpul(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdslIndrRmPostincFpscr final : public Instruction {
  public:
-  explicit LdslIndrRmPostincFpscr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdslIndrRmPostincFpul final : public Instruction {
  public:
-  explicit LdslIndrRmPostincFpul(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StsFpscrRn final : public Instruction {
  public:
-  explicit StsFpscrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StsFpulRn final : public Instruction {
  public:
-  explicit StsFpulRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StslFpscrIndrPredecRn final : public Instruction {
  public:
-  explicit StslFpscrIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StslFpulIndrPredecRn final : public Instruction {
  public:
-  explicit StslFpulIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class JmpIndrRm final : public Instruction {
  public:
-  explicit JmpIndrRm(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class JsrIndrRm final : public Instruction {
  public:
-  explicit JsrIndrRm(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
-
-  static uint32_t GetTarget(uint16_t opcode, uint64_t addr);
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class LdcRmSr final : public Instruction {
  public:
-  explicit LdcRmSr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdcRmGbr final : public Instruction {
  public:
-  explicit LdcRmGbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdcRmVbr final : public Instruction {
  public:
-  explicit LdcRmVbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdclIndrRmPostincSr final : public Instruction {
  public:
-  explicit LdclIndrRmPostincSr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdclIndrRmPostincGbr final : public Instruction {
  public:
-  explicit LdclIndrRmPostincGbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdclIndrRmPostincVbr final : public Instruction {
  public:
-  explicit LdclIndrRmPostincVbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdsRmMach final : public Instruction {
  public:
-  explicit LdsRmMach(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdsRmMacl final : public Instruction {
  public:
-  explicit LdsRmMacl(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdsRmPr final : public Instruction {
  public:
-  explicit LdsRmPr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdslIndrRmPostincMach final : public Instruction {
  public:
-  explicit LdslIndrRmPostincMach(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdslIndrRmPostincMacl final : public Instruction {
  public:
-  explicit LdslIndrRmPostincMacl(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class LdslIndrRmPostincPr final : public Instruction {
  public:
-  explicit LdslIndrRmPostincPr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class MaclIndrRmPostincIndrRnPostinc final : public Instruction {
  public:
-  explicit MaclIndrRmPostincIndrRnPostinc(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class MacwIndrRmPostincIndrRnPostinc final : public Instruction {
  public:
-  explicit MacwIndrRmPostincIndrRnPostinc(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class MacIndrRmPostincIndrRnPostinc final : public Instruction {
  public:
-  explicit MacIndrRmPostincIndrRnPostinc(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class MovRmRn final : public Instruction {
  public:
-  explicit MovRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbRmIndrRn final : public Instruction {
  public:
-  explicit MovbRmIndrRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwRmIndrRn final : public Instruction {
  public:
-  explicit MovwRmIndrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlRmIndrRn final : public Instruction {
  public:
-  explicit MovlRmIndrRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbIndrRmRn final : public Instruction {
  public:
-  explicit MovbIndrRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwIndrRmRn final : public Instruction {
  public:
-  explicit MovwIndrRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlIndrRmRn final : public Instruction {
  public:
-  explicit MovlIndrRmRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbRmIndrPredecRn final : public Instruction {
  public:
-  explicit MovbRmIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwRmIndrPredecRn final : public Instruction {
  public:
-  explicit MovwRmIndrPredecRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlRmIndrPredecRn final : public Instruction {
  public:
-  explicit MovlRmIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbIndrRmPostincRn final : public Instruction {
  public:
-  explicit MovbIndrRmPostincRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwIndrRmPostincRn final : public Instruction {
  public:
-  explicit MovwIndrRmPostincRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlIndrRmPostincRn final : public Instruction {
  public:
-  explicit MovlIndrRmPostincRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbRmIndrR0Rn final : public Instruction {
  public:
-  explicit MovbRmIndrR0Rn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwRmIndrR0Rn final : public Instruction {
  public:
-  explicit MovwRmIndrR0Rn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlRmIndrR0Rn final : public Instruction {
  public:
-  explicit MovlRmIndrR0Rn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbIndrR0RmRn final : public Instruction {
  public:
-  explicit MovbIndrR0RmRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwIndrR0RmRn final : public Instruction {
  public:
-  explicit MovwIndrR0RmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlIndrR0RmRn final : public Instruction {
  public:
-  explicit MovlIndrR0RmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovImmRn final : public Instruction {
  public:
-  explicit MovImmRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwIndrDispPcRn final : public Instruction {
  public:
-  explicit MovwIndrDispPcRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlIndrDispPcRn final : public Instruction {
  public:
-  explicit MovlIndrDispPcRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbIndrDispGbrR0 final : public Instruction {
  public:
-  explicit MovbIndrDispGbrR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwIndrDispGbrR0 final : public Instruction {
  public:
-  explicit MovwIndrDispGbrR0(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlIndrDispGbrR0 final : public Instruction {
  public:
-  explicit MovlIndrDispGbrR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbR0IndrDispGbr final : public Instruction {
  public:
-  explicit MovbR0IndrDispGbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwR0IndrDispGbr final : public Instruction {
  public:
-  explicit MovwR0IndrDispGbr(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlR0IndrDispGbr final : public Instruction {
  public:
-  explicit MovlR0IndrDispGbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbR0IndrDispRn final : public Instruction {
  public:
-  explicit MovbR0IndrDispRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwR0IndrDispRn final : public Instruction {
  public:
-  explicit MovwR0IndrDispRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlRmIndrDispRn final : public Instruction {
  public:
-  explicit MovlRmIndrDispRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovbIndrDispRmR0 final : public Instruction {
  public:
-  explicit MovbIndrDispRmR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovwIndrDispRmR0 final : public Instruction {
  public:
-  explicit MovwIndrDispRmR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovlIndrDispRmRn final : public Instruction {
  public:
-  explicit MovlIndrDispRmRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovaIndrDispPcR0 final : public Instruction {
  public:
-  explicit MovaIndrDispPcR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MovtRn final : public Instruction {
  public:
-  explicit MovtRn(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class MullRmRn final : public Instruction {
  public:
-  explicit MullRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class MulswRmRn final : public Instruction {
  public:
-  explicit MulswRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class MulsRmRn final : public Instruction {
  public:
-  explicit MulsRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class MuluwRmRn final : public Instruction {
  public:
-  explicit MuluwRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class MuluRmRn final : public Instruction {
  public:
-  explicit MuluRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class NegRmRn final : public Instruction {
  public:
-  explicit NegRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class NegcRmRn final : public Instruction {
  public:
-  explicit NegcRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Nop final : public Instruction {
  public:
-  explicit Nop(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class NotRmRn final : public Instruction {
  public:
-  explicit NotRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class OrRmRn final : public Instruction {
  public:
-  explicit OrRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class OrImmR0 final : public Instruction {
  public:
-  explicit OrImmR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class OrbImmIndrR0Gbr final : public Instruction {
  public:
-  explicit OrbImmIndrR0Gbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class RotclRn final : public Instruction {
  public:
-  explicit RotclRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class RotcrRn final : public Instruction {
  public:
-  explicit RotcrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class RotlRn final : public Instruction {
  public:
-  explicit RotlRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class RotrRn final : public Instruction {
  public:
-  explicit RotrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Rte final : public Instruction {
  public:
-  explicit Rte(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  // TODO: Lift
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class Rts final : public Instruction {
  public:
-  explicit Rts(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Info(uint16_t opcode, uint64_t addr,
-            BN::InstructionInfo &result) override;
+  bool Info(const DecodedInsn &insn, uint64_t addr,
+            BN::InstructionInfo &result) const override;
 
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class Sett final : public Instruction {
  public:
-  explicit Sett(const IsaType &t);
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
-
-  bool Lift(uint16_t opcode, uint64_t addr, size_t &len,
-            BN::LowLevelILFunction &il, BN::Architecture *arch) override;
+  bool Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            BN::LowLevelILFunction &il, BN::Architecture *arch) const override;
 };
 
 class ShalRn final : public Instruction {
  public:
-  explicit ShalRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class SharRn final : public Instruction {
  public:
-  explicit SharRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class ShllRn final : public Instruction {
  public:
-  explicit ShllRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Shll2Rn final : public Instruction {
  public:
-  explicit Shll2Rn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Shll8Rn final : public Instruction {
  public:
-  explicit Shll8Rn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Shll16Rn final : public Instruction {
  public:
-  explicit Shll16Rn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class ShlrRn final : public Instruction {
  public:
-  explicit ShlrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Shlr2Rn final : public Instruction {
  public:
-  explicit Shlr2Rn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Shlr8Rn final : public Instruction {
  public:
-  explicit Shlr8Rn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Shlr16Rn final : public Instruction {
  public:
-  explicit Shlr16Rn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class Sleep final : public Instruction {
  public:
-  explicit Sleep(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StcSrRn final : public Instruction {
  public:
-  explicit StcSrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StcGbrRn final : public Instruction {
  public:
-  explicit StcGbrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StcVbrRn final : public Instruction {
  public:
-  explicit StcVbrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StclSrIndrPredecRn final : public Instruction {
  public:
-  explicit StclSrIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StclGbrIndrPredecRn final : public Instruction {
  public:
-  explicit StclGbrIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StclVbrIndrPredecRn final : public Instruction {
  public:
-  explicit StclVbrIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StsMachRn final : public Instruction {
  public:
-  explicit StsMachRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StsMaclRn final : public Instruction {
  public:
-  explicit StsMaclRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StsPrRn final : public Instruction {
  public:
-  explicit StsPrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StslMachIndrPredecRn final : public Instruction {
  public:
-  explicit StslMachIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StslMaclIndrPredecRn final : public Instruction {
  public:
-  explicit StslMaclIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class StslPrIndrPredecRn final : public Instruction {
  public:
-  explicit StslPrIndrPredecRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class SubRmRn final : public Instruction {
  public:
-  explicit SubRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class SubcRmRn final : public Instruction {
  public:
-  explicit SubcRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class SubvRmRn final : public Instruction {
  public:
-  explicit SubvRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class SwapbRmRn final : public Instruction {
  public:
-  explicit SwapbRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class SwapwRmRn final : public Instruction {
  public:
-  explicit SwapwRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class TasbIndrRn final : public Instruction {
  public:
-  explicit TasbIndrRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class TrapaImm final : public Instruction {
  public:
-  explicit TrapaImm(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class TstRmRn final : public Instruction {
  public:
-  explicit TstRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class TstImmR0 final : public Instruction {
  public:
-  explicit TstImmR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class TstbImmIndrR0Gbr final : public Instruction {
  public:
-  explicit TstbImmIndrR0Gbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class XorRmRn final : public Instruction {
  public:
-  explicit XorRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class XorImmR0 final : public Instruction {
  public:
-  explicit XorImmR0(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class XorbImmIndrR0Gbr final : public Instruction {
  public:
-  explicit XorbImmIndrR0Gbr(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
 
 class XtrctRmRn final : public Instruction {
  public:
-  explicit XtrctRmRn(const IsaType &t);
-
-  bool Text(uint16_t opcode, uint64_t addr, size_t &len,
-            std::vector<BN::InstructionTextToken> &result) override;
+  template <class SYNTAX, class OUT>
+  bool Text(const DecodedInsn &insn, uint64_t addr, size_t &len,
+            OUT &result) const;
 
   // TODO: Lift
 };
+
+/*
+ * Instruction classes hold no state, so every decode of a given class on any
+ * ISA shares one immutable instance. The instances are constructed on first
+ * use and never freed.
+ */
+template <class T>
+const Instruction *Flyweight() {
+  static const T instance;
+  return &instance;
+}
+
+/*
+ * Calls `f` with an instance of the class of instruction `id`. Every case
+ * names a final class, so method calls made by `f` bind statically and can be
+ * inlined in the file that defines the methods.
+ */
+template <class F>
+decltype(auto) Visit(const InsnId id, F &&f) {
+  switch (id) {
+#define SUPERH_VISIT(name) \
+  case InsnId::name:       \
+    return f(name());
+    SUPERH_INSTRUCTIONS(SUPERH_VISIT)
+#undef SUPERH_VISIT
+  }
+
+  // Only reached for a value that is not an InsnId
+  return decltype(f(Nop())){};
+}
 }  // namespace SuperH
 
 #endif  // SRC_INSTRUCTIONS_H_
@@ -0,0 +1,735 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <thread>
+#include <typeinfo>
+#include <vector>
+
+#include "allocation_counter.h"
+#include "branches.h"
+#include "classifier.h"
+#include "density.h"
+#include "hex.h"
+#include "instructions.h"
+#include "listing.h"
+#include "pool.h"
+#include "opcodes.h"
+#include "properties.h"
+#include "spec.h"
+#include "syntax.h"
+
+namespace BN = BinaryNinja;
+namespace SH = SuperH;
+
+// Test that decoding every possible opcode never allocates
+class TestDecodeAllocations : public ::testing::TestWithParam<SH::IsaType> {};
+
+TEST_P(TestDecodeAllocations, TestDecode) {
+  const auto isa = GetParam();
+
+  // Warm up the shared instruction instances before counting
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    SH::DecodeInstruction(isa, static_cast<uint16_t>(opcode));
+  }
+
+  const size_t before = SH::AllocationCount();
+  size_t decoded = 0;
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    if (SH::DecodeInstruction(isa, static_cast<uint16_t>(opcode))) {
+      decoded++;
+    }
+  }
+
+  EXPECT_EQ(SH::AllocationCount() - before, 0);
+  EXPECT_GT(decoded, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(TestAllIsas, TestDecodeAllocations,
+                         ::testing::Values(SH::SH_1_ISA, SH::SH_2E_ISA,
+                                           SH::SH_DSP_ISA));
+
+// Test that repeated decodes of an opcode share one instance across ISAs
+TEST(TestDecodeShared, TestDecode) {
+  const auto a = SH::DecodeInstruction(SH::SH_1_ISA, SH::Opcodes::Nop);
+  const auto b = SH::DecodeInstruction(SH::SH_1_ISA, SH::Opcodes::Nop);
+  const auto c = SH::DecodeInstruction(SH::SH_2E_ISA, SH::Opcodes::Nop);
+
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(a, c);
+}
+
+// Test that the compile-time decoders agree with the runtime dispatch
+TEST(TestDecodeSpecialized, TestDecode) {
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    const auto op = static_cast<uint16_t>(opcode);
+    SH::DecodedInsn insn{};
+    EXPECT_EQ(SH::DecodeInstruction<SH::SH_1_ISA>(op, 0x0, insn),
+              SH::DecodeInstruction(SH::SH_1_ISA, op));
+    EXPECT_EQ(SH::DecodeInstruction<SH::SH_2E_ISA>(op, 0x0, insn),
+              SH::DecodeInstruction(SH::SH_2E_ISA, op));
+  }
+}
+
+// Test that the dispatch tables agree with a scan of the specifications
+class TestDecodeTable : public ::testing::TestWithParam<SH::IsaType> {};
+
+TEST_P(TestDecodeTable, TestDecode) {
+  const auto isa = GetParam();
+
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    const auto op = static_cast<uint16_t>(opcode);
+    const auto spec = SH::FindSpec(isa, op);
+    SH::DecodedInsn insn{};
+    const auto i = SH::DecodeInstruction(isa, op, 0x0, insn);
+    ASSERT_EQ(i != nullptr, spec != nullptr)
+        << "opcode 0x" << std::hex << opcode;
+    if (spec) {
+      ASSERT_EQ(insn.id, spec->id) << "opcode 0x" << std::hex << opcode;
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestAllIsas, TestDecodeTable,
+                         ::testing::Values(SH::SH_1_ISA, SH::SH_2E_ISA,
+                                           SH::SH_DSP_ISA));
+
+// Test that the text of every specified instruction starts with its mnemonic
+class TestSpecMnemonic : public ::testing::TestWithParam<SH::IsaType> {};
+
+TEST_P(TestSpecMnemonic, TestText) {
+  const auto isa = GetParam();
+
+  for (const auto &spec : SH::SPECS) {
+    if (!spec.Supports(isa)) {
+      continue;
+    }
+
+    size_t len = 0;
+    auto tokens = std::vector<BN::InstructionTextToken>{};
+    SH::DecodedInsn insn{};
+    ASSERT_NE(SH::DecodeInstruction(isa, spec.Match(), 0x0, insn), nullptr)
+        << spec.pattern;
+    ASSERT_TRUE(SH::DispatchText(insn, 0x0, len, tokens)) << spec.pattern;
+    ASSERT_FALSE(tokens.empty()) << spec.pattern;
+    EXPECT_EQ(tokens[0].text, spec.mnemonic) << spec.pattern;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestAllIsas, TestSpecMnemonic,
+                         ::testing::Values(SH::SH_1_ISA, SH::SH_2E_ISA,
+                                           SH::SH_DSP_ISA));
+
+// Test that id dispatch reaches the class that decoding returned, and that
+// every syntax renders the same operands
+class TestDispatch : public ::testing::TestWithParam<SH::IsaType> {};
+
+TEST_P(TestDispatch, TestText) {
+  const auto isa = GetParam();
+
+  for (const auto &spec : SH::SPECS) {
+    if (!spec.Supports(isa)) {
+      continue;
+    }
+
+    SH::DecodedInsn insn{};
+    const auto i = SH::DecodeInstruction(isa, spec.Match(), 0x1000, insn);
+    ASSERT_NE(i, nullptr) << spec.pattern;
+    const auto type =
+        SH::Visit(insn.id, [](const auto &c) { return &typeid(c); });
+    ASSERT_NE(type, nullptr) << spec.pattern;
+    EXPECT_EQ(typeid(*i), *type) << spec.pattern;
+
+    // GNU drops only the "@" and "#" before PC-relative addresses
+    size_t len = 0;
+    auto renesas = std::vector<BN::InstructionTextToken>{};
+    auto gnu = std::vector<BN::InstructionTextToken>{};
+    ASSERT_TRUE(
+        SH::DispatchText<SH::RenesasSyntax>(insn, 0x1000, len, renesas))
+        << spec.pattern;
+    ASSERT_TRUE(SH::DispatchText<SH::GnuSyntax>(insn, 0x1000, len, gnu))
+        << spec.pattern;
+    std::erase_if(renesas, [](const auto &t) {
+      return t.type == TextToken && (t.text == "@" || t.text == "#");
+    });
+    std::erase_if(gnu, [](const auto &t) {
+      return t.type == TextToken && t.text == "#";
+    });
+    ASSERT_EQ(renesas.size(), gnu.size()) << spec.pattern;
+    for (size_t t = 0; t < renesas.size(); t++) {
+      EXPECT_EQ(renesas[t].type, gnu[t].type) << spec.pattern;
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestAllIsas, TestDispatch,
+                         ::testing::Values(SH::SH_1_ISA, SH::SH_2E_ISA,
+                                           SH::SH_DSP_ISA));
+
+// Test that operand fields derived from patterns match the field extractors
+TEST(TestSpecFields, TestExtract) {
+  constexpr uint16_t opcode = 0b1010010110100101;
+
+  constexpr auto n = SH::FieldOf("0011nnnnmmmm1100", 'n');
+  constexpr auto m = SH::FieldOf("0011nnnnmmmm1100", 'm');
+  const auto [want_n, want_m] = SH::GetNMFormatOpcodeFields(opcode);
+  EXPECT_EQ(n.Extract(opcode), want_n);
+  EXPECT_EQ(m.Extract(opcode), want_m);
+
+  constexpr auto d = SH::FieldOf("1010dddddddddddd", 'd');
+  EXPECT_EQ(d.Extract(opcode), SH::ExtractD12FormatOpcodeFields(opcode));
+
+  constexpr auto nd4 = SH::FieldOf("10000001nnnndddd", 'n');
+  EXPECT_EQ(nd4.Extract(opcode),
+            SH::ExtractND4FormatOpcodeFields(opcode).first);
+}
+
+// Test that decoding pre-extracts, extends and scales operands
+TEST(TestDecodedInsn, TestOperands) {
+  SH::DecodedInsn insn{};
+
+  // ADD #-1,R3: sign-extended immediate
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0x73FF, 0x1000, insn), nullptr);
+  EXPECT_EQ(insn.n, 3);
+  EXPECT_EQ(insn.imm, -1);
+  EXPECT_EQ(insn.raw, 0xFF);
+  EXPECT_EQ(insn.flags & SH::DecodedInsn::PC_RELATIVE, 0);
+
+  // AND #0xFF,R0: zero-extended immediate
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0xC9FF, 0x1000, insn), nullptr);
+  EXPECT_EQ(insn.imm, 0xFF);
+
+  // MOV.L @(3,R5),R2: displacement scaled to bytes
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0x5253, 0x1000, insn), nullptr);
+  EXPECT_EQ(insn.n, 2);
+  EXPECT_EQ(insn.m, 5);
+  EXPECT_EQ(insn.raw, 3);
+  EXPECT_EQ(insn.imm, 12);
+
+  // BRA with a negative displacement
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0xAFFE, 0x1000, insn), nullptr);
+  EXPECT_EQ(insn.imm, -4);
+  EXPECT_EQ(insn.target, 0x1000);
+  EXPECT_NE(insn.flags & SH::DecodedInsn::PC_RELATIVE, 0);
+
+  // BT with a positive displacement
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0x8910, 0x1000, insn), nullptr);
+  EXPECT_EQ(insn.target, 0x1024);
+
+  // MOV.L @(1,PC),R0 from an address that is not longword aligned
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0xD001, 0x1002, insn), nullptr);
+  EXPECT_EQ(insn.target, 0x1008);
+
+  // MOV.W @(1,PC),R0 is not aligned down
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0x9001, 0x1002, insn), nullptr);
+  EXPECT_EQ(insn.target, 0x1008);
+}
+
+// Test that batch decoding agrees with decoding one halfword at a time
+class TestDecodeRange : public ::testing::TestWithParam<SH::IsaType> {};
+
+TEST_P(TestDecodeRange, TestDecode) {
+  const auto isa = GetParam();
+  constexpr uint64_t base = 0x8000fff0;
+
+  // Every opcode in big-endian order, starting at an odd offset to exercise
+  // unaligned loads, with a trailing odd byte
+  std::vector<uint8_t> bytes(1 + 2 * 0x10000 + 1);
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    bytes[1 + 2 * opcode] = opcode >> 8;
+    bytes[2 + 2 * opcode] = opcode & 0xFF;
+  }
+
+  SH::DecodedRange out;
+  ASSERT_EQ(SH::DecodeRange(isa, bytes.data() + 1, bytes.size() - 1, base, out),
+            0x10000);
+  ASSERT_EQ(out.size(), 0x10000);
+
+  for (uint32_t i = 0; i <= 0xFFFF; i++) {
+    const auto op = static_cast<uint16_t>(i);
+    SH::DecodedInsn insn{};
+    const auto addr = base + 2 * i;
+    ASSERT_EQ(out.opcodes[i], op);
+    if (SH::DecodeInstruction(isa, op, addr, insn) == nullptr) {
+      ASSERT_EQ(out.ids[i], SH::DecodedRange::INVALID)
+          << "opcode 0x" << std::hex << i;
+      continue;
+    }
+    ASSERT_EQ(static_cast<SH::InsnId>(out.ids[i]), insn.id)
+        << "opcode 0x" << std::hex << i;
+    ASSERT_EQ(out.n[i], insn.n) << "opcode 0x" << std::hex << i;
+    ASSERT_EQ(out.m[i], insn.m) << "opcode 0x" << std::hex << i;
+    ASSERT_EQ(out.flags[i], insn.flags) << "opcode 0x" << std::hex << i;
+    ASSERT_EQ(out.imm[i], insn.imm) << "opcode 0x" << std::hex << i;
+    ASSERT_EQ(out.targets[i], insn.target) << "opcode 0x" << std::hex << i;
+  }
+
+  // Shorter ranges reuse the arrays and take the scalar tail
+  ASSERT_EQ(SH::DecodeRange(isa, bytes.data() + 1, 7, base, out), 3);
+  EXPECT_EQ(out.size(), 3);
+  EXPECT_EQ(out.opcodes[2], 0x0002);
+}
+
+INSTANTIATE_TEST_SUITE_P(TestAllIsas, TestDecodeRange,
+                         ::testing::Values(SH::SH_1_ISA, SH::SH_2E_ISA,
+                                           SH::SH_DSP_ISA));
+
+// Test that the property table agrees with the branches reported by Info
+class TestProperties : public ::testing::TestWithParam<SH::IsaType> {};
+
+TEST_P(TestProperties, TestInfo) {
+  const auto isa = GetParam();
+
+  for (const auto &spec : SH::SPECS) {
+    if (!spec.Supports(isa)) {
+      continue;
+    }
+
+    SH::DecodedInsn insn{};
+    ASSERT_NE(SH::DecodeInstruction(isa, spec.Match(), 0x1000, insn), nullptr)
+        << spec.pattern;
+    BN::InstructionInfo result;
+    ASSERT_TRUE(SH::DispatchInfo(insn, 0x1000, result)) << spec.pattern;
+
+    const auto &props = SH::PropertiesOf(insn);
+    // Calls through a register have no destination to report
+    const bool register_call = props.branch == SH::BranchKind::CALL &&
+                               insn.id != SH::InsnId::BsrDisp;
+    const bool branches = props.branch != SH::BranchKind::NONE &&
+                          props.branch != SH::BranchKind::TRAP &&
+                          !register_call;
+    EXPECT_EQ(result.branchCount > 0, branches) << spec.pattern;
+    EXPECT_EQ(result.delaySlots > 0, props.delay_slot) << spec.pattern;
+    EXPECT_EQ(props.illegal_in_slot, props.branch != SH::BranchKind::NONE)
+        << spec.pattern;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(TestAllIsas, TestProperties,
+                         ::testing::Values(SH::SH_1_ISA, SH::SH_2E_ISA,
+                                           SH::SH_DSP_ISA));
+
+// Test register, memory and T bit properties of a few instructions
+TEST(TestInsnProperties, TestRegisters) {
+  constexpr auto bit = SH::RegisterBit;
+  SH::DecodedInsn insn{};
+
+  // ADD R4,R3
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0x334C, 0x1000, insn), nullptr);
+  EXPECT_EQ(SH::RegistersRead(insn), bit(SH::Registers::R3) | bit(4));
+  EXPECT_EQ(SH::RegistersWritten(insn), bit(SH::Registers::R3));
+  EXPECT_EQ(SH::PropertiesOf(insn).mem_width, 0);
+  EXPECT_FALSE(SH::PropertiesOf(insn).writes_t);
+
+  // CMP/EQ R4,R3 only reads its operands
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0x3340, 0x1000, insn), nullptr);
+  EXPECT_EQ(SH::RegistersRead(insn), bit(3) | bit(4));
+  EXPECT_EQ(SH::RegistersWritten(insn), 0);
+  EXPECT_TRUE(SH::PropertiesOf(insn).writes_t);
+
+  // MOV.L @(1,PC),R0
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0xD001, 0x1000, insn), nullptr);
+  EXPECT_EQ(SH::PropertiesOf(insn).mem_width, 4);
+  EXPECT_EQ(SH::RegistersRead(insn), bit(SH::Registers::PC));
+  EXPECT_EQ(SH::RegistersWritten(insn), bit(SH::Registers::R0));
+
+  // MOV.B R2,@-R15
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0x2F24, 0x1000, insn), nullptr);
+  EXPECT_EQ(SH::PropertiesOf(insn).mem_width, 1);
+  EXPECT_EQ(SH::RegistersRead(insn), bit(2) | bit(15));
+  EXPECT_EQ(SH::RegistersWritten(insn), bit(15));
+
+  // MOVA @(1,PC),R0 computes an address without loading from it
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0xC701, 0x1000, insn), nullptr);
+  EXPECT_EQ(SH::PropertiesOf(insn).mem_width, 0);
+
+  // BT reads T and has no delay slot
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0x8910, 0x1000, insn), nullptr);
+  EXPECT_EQ(SH::PropertiesOf(insn).branch, SH::BranchKind::CONDITIONAL);
+  EXPECT_TRUE(SH::PropertiesOf(insn).reads_t);
+  EXPECT_FALSE(SH::PropertiesOf(insn).delay_slot);
+
+  // RTS reads PR
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_1_ISA, 0x000B, 0x1000, insn), nullptr);
+  EXPECT_EQ(SH::PropertiesOf(insn).branch, SH::BranchKind::RETURN);
+  EXPECT_NE(SH::RegistersRead(insn) & bit(SH::Registers::PR), 0);
+
+  // FADD FR2,FR1 on SH-2E
+  ASSERT_NE(SH::DecodeInstruction(SH::SH_2E_ISA, 0xF120, 0x1000, insn),
+            nullptr);
+  EXPECT_EQ(SH::RegistersRead(insn),
+            bit(SH::Registers::FR0 + 1) | bit(SH::Registers::FR0 + 2));
+  EXPECT_EQ(SH::RegistersWritten(insn), bit(SH::Registers::FR0 + 1));
+}
+
+// Test that the branch edge pass finds exactly the direct branches decoded
+class TestBranchEdges : public ::testing::TestWithParam<SH::IsaType> {};
+
+TEST_P(TestBranchEdges, TestDecode) {
+  const auto isa = GetParam();
+  constexpr uint64_t base = 0x8000fff0;
+
+  // Every opcode in big-endian order at an odd offset, with a trailing odd
+  // byte
+  std::vector<uint8_t> bytes(1 + 2 * 0x10000 + 1);
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    bytes[1 + 2 * opcode] = opcode >> 8;
+    bytes[2 + 2 * opcode] = opcode & 0xFF;
+  }
+
+  std::vector<SH::BranchEdge> edges;
+  SH::FindBranchEdges(isa, bytes.data() + 1, bytes.size() - 1, base, edges);
+
+  size_t e = 0;
+  for (uint32_t i = 0; i <= 0xFFFF; i++) {
+    SH::DecodedInsn insn{};
+    const auto addr = base + 2 * i;
+    if (SH::DecodeInstruction(isa, i, addr, insn) == nullptr ||
+        !(insn.id == SH::InsnId::BtDisp || insn.id == SH::InsnId::BfDisp ||
+          insn.id == SH::InsnId::BtsDisp || insn.id == SH::InsnId::BfsDisp ||
+          insn.id == SH::InsnId::BraDisp || insn.id == SH::InsnId::BsrDisp)) {
+      continue;
+    }
+    ASSERT_LT(e, edges.size()) << "opcode 0x" << std::hex << i;
+    EXPECT_EQ(edges[e].source, static_cast<uint32_t>(addr));
+    EXPECT_EQ(edges[e].target, insn.target) << "opcode 0x" << std::hex << i;
+    EXPECT_EQ(edges[e].id, insn.id) << "opcode 0x" << std::hex << i;
+    EXPECT_EQ(edges[e].kind, SH::PropertiesOf(insn).branch);
+    e++;
+  }
+  EXPECT_EQ(e, edges.size());
+
+  // A short range takes the scalar path only
+  ASSERT_EQ(SH::FindBranchEdges(isa, bytes.data() + 1 + 2 * 0xA000, 6,
+                                base + 2 * 0xA000, edges),
+            3);
+  EXPECT_EQ(edges[2].target, base + 2 * 0xA002 + 4 + 4);
+  EXPECT_EQ(edges[2].kind, SH::BranchKind::JUMP);
+}
+
+INSTANTIATE_TEST_SUITE_P(TestAllIsas, TestBranchEdges,
+                         ::testing::Values(SH::SH_1_ISA, SH::SH_2E_ISA,
+                                           SH::SH_DSP_ISA));
+
+// Test that the valid opcode bitmap and density scores agree with decoding
+class TestCodeDensity : public ::testing::TestWithParam<SH::IsaType> {};
+
+TEST_P(TestCodeDensity, TestScore) {
+  const auto isa = GetParam();
+  const auto &bitmap = SH::GetValidOpcodes(isa);
+  static_assert(sizeof(bitmap) == 8192);
+
+  for (uint32_t i = 0; i <= 0xFFFF; i++) {
+    const bool valid = SH::DecodeInstruction(isa, i) != nullptr;
+    ASSERT_EQ((bitmap[i / 64] >> (i % 64)) & 1, valid)
+        << "opcode 0x" << std::hex << i;
+  }
+
+  // Pseudo-random bytes at an odd offset, scored in overlapping windows that
+  // straddle bitmap words
+  std::vector<uint8_t> bytes(1 + 2 * 1000 + 1);
+  uint32_t state = 1;
+  for (auto &b : bytes) {
+    state = state * 1103515245 + 12345;
+    b = state >> 24;
+  }
+  constexpr size_t window = 100, step = 7;
+  std::vector<float> scores;
+  ASSERT_EQ(SH::ScoreCodeDensity(isa, bytes.data() + 1, bytes.size() - 1,
+                                 window, step, scores),
+            (1000 - window) / step + 1);
+  for (size_t w = 0; w < scores.size(); w++) {
+    size_t valid = 0;
+    for (size_t i = w * step; i < w * step + window; i++) {
+      const uint16_t op = bytes[1 + 2 * i] << 8 | bytes[2 + 2 * i];
+      valid += SH::DecodeInstruction(isa, op) != nullptr;
+    }
+    EXPECT_FLOAT_EQ(scores[w], static_cast<float>(valid) / window) << w;
+  }
+
+  // A buffer shorter than one window has no scores
+  EXPECT_EQ(SH::ScoreCodeDensity(isa, bytes.data(), 2 * window - 1, window,
+                                 step, scores),
+            0);
+  EXPECT_TRUE(scores.empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(TestAllIsas, TestCodeDensity,
+                         ::testing::Values(SH::SH_1_ISA, SH::SH_2E_ISA,
+                                           SH::SH_DSP_ISA));
+
+// Test that a synthetic image is labelled by region, independent of threads
+TEST(TestClassifier, TestImage) {
+  // A function that loads a constant from its literal pool, calls it and
+  // returns, followed by alignment padding and the pool
+  const std::vector<uint16_t> function = {
+      0x2FE6,  // MOV.L R14,@-R15
+      0x4F22,  // STS.L PR,@-R15
+      0x6EF3,  // MOV R15,R14
+      0xD107,  // MOV.L @(7,PC),R1
+      0xE405,  // MOV #5,R4
+      0x410B,  // JSR @R1
+      0x6543,  // MOV R4,R5
+      0x8800,  // CMP/EQ #0,R0
+      0x8B02,  // BF +2
+      0x7401,  // ADD #1,R4
+      0x6242,  // MOV.L @R4,R2
+      0x622C,  // EXTU.B R2,R2
+      0x2228,  // TST R2,R2
+      0x4F26,  // LDS.L @R15+,PR
+      0x000B,  // RTS
+      0x6EF6,  // MOV.L @R15+,R14
+      0x0009,  // NOP (alignment)
+      0x0009,  // NOP (alignment)
+      0x1234,  // pool: .long 0x12345678
+      0x5678,
+  };
+  constexpr size_t functions = 8000, random = 60000, fill = 4000;
+
+  std::vector<uint8_t> bytes;
+  const auto push = [&](const uint16_t h) {
+    bytes.push_back(h >> 8);
+    bytes.push_back(h & 0xFF);
+  };
+  for (size_t f = 0; f < functions; f++) {
+    for (const auto h : function) {
+      push(h);
+    }
+  }
+  uint32_t state = 1;
+  for (size_t i = 0; i < random; i++) {
+    state = state * 1103515245 + 12345;
+    push(state >> 16);
+  }
+  for (size_t i = 0; i < fill; i++) {
+    push(0xFFFF);
+  }
+
+  const auto labels = SH::ClassifyImage(SH::SH_2E_ISA, bytes.data(),
+                                        bytes.size(), 0x1000, 1);
+  ASSERT_EQ(labels.size(), bytes.size() / 2);
+
+  // Within code, only the last function can border anything else
+  for (size_t f = 0; f + 1 < functions; f++) {
+    const size_t at = f * function.size();
+    for (size_t i = 0; i < 16; i++) {
+      ASSERT_EQ(labels[at + i], SH::Label::CODE) << at + i;
+    }
+    ASSERT_EQ(labels[at + 16], SH::Label::PADDING) << at + 16;
+    ASSERT_EQ(labels[at + 17], SH::Label::PADDING) << at + 17;
+    ASSERT_EQ(labels[at + 18], SH::Label::POOL) << at + 18;
+    ASSERT_EQ(labels[at + 19], SH::Label::POOL) << at + 19;
+  }
+
+  // Random bytes are mostly data, and the fill is padding
+  const size_t code = functions * function.size();
+  size_t data = 0;
+  for (size_t i = code; i < code + random; i++) {
+    data += labels[i] == SH::Label::DATA;
+  }
+  EXPECT_GT(data, random * 9 / 10);
+  for (size_t i = code + random; i < labels.size(); i++) {
+    ASSERT_EQ(labels[i], SH::Label::PADDING) << i;
+  }
+
+  // Chunks labelled on several threads give the same map
+  const auto threaded = SH::ClassifyImage(SH::SH_2E_ISA, bytes.data(),
+                                          bytes.size(), 0x1000, 4);
+  for (size_t i = 0; i < labels.size(); i++) {
+    ASSERT_EQ(labels[i], threaded[i]) << i;
+  }
+
+  // Pools are found the same way above 4 GB and in an image that crosses it
+  for (const uint64_t base : {uint64_t{0x100001000}, uint64_t{0xFFFF1000}}) {
+    const auto moved =
+        SH::ClassifyImage(SH::SH_2E_ISA, bytes.data(), bytes.size(), base, 4);
+    for (size_t i = 0; i < labels.size(); i++) {
+      ASSERT_EQ(labels[i], moved[i]) << base << " " << i;
+    }
+  }
+}
+
+// Test that the hex formatters match the printf formats they replace
+TEST(TestHex, TestPrintfFormats) {
+  char expected[19];
+  for (uint32_t i = 0; i <= 0xFF; i++) {
+    std::snprintf(expected, sizeof(expected), "%#hhx",
+                  static_cast<uint8_t>(i));
+    ASSERT_EQ(SH::FormatImmediate(i), expected) << i;
+  }
+  for (const uint64_t value :
+       {0x0ull, 0x1ull, 0xFull, 0x10ull, 0x3Cull, 0x1FEull, 0xFFFFFFFFull,
+        0xFFFFFFFFFFFFFFFFull}) {
+    std::snprintf(expected, sizeof(expected), "%#llx",
+                  static_cast<unsigned long long>(value));
+    ASSERT_EQ(SH::FormatHex(value), expected) << value;
+    std::snprintf(expected, sizeof(expected), "0x%llx",
+                  static_cast<unsigned long long>(value));
+    ASSERT_EQ(SH::FormatAddress(value), expected) << value;
+  }
+}
+
+// Test the lines of a listing, including undefined opcodes and an odd byte
+TEST(TestListing, TestRenderListing) {
+  const std::vector<uint8_t> bytes = {0xD1, 0x03, 0xFF, 0xFF, 0x00, 0x0B, 0x42};
+  std::string out;
+  SH::RenderListing(SH::SH_1_ISA, BigEndian, bytes.data(), bytes.size(),
+                    0x1000, {}, out);
+  EXPECT_EQ(out,
+            "00001000  d103  MOV.L @0x1010,R1\n"
+            "00001002  ffff  .word 0xffff\n"
+            "00001004  000b  RTS\n"
+            "00001006  42    .byte 0x42\n");
+
+  const std::vector<uint8_t> little = {0x03, 0xD1};
+  out.clear();
+  SH::RenderListing(SH::SH_1_ISA, LittleEndian, little.data(), little.size(),
+                    0x1000, {.lowercase = true}, out);
+  EXPECT_EQ(out, "00001000  d103  mov.l @0x1010,r1\n");
+}
+
+// Test that a listing written in chunks on several threads is the listing of
+// each range in address order
+TEST(TestListing, TestWriteListing) {
+  std::vector<uint8_t> bytes(2 * 0x10000);
+  for (uint32_t opcode = 0; opcode <= 0xFFFF; opcode++) {
+    bytes[2 * opcode] = opcode >> 8;
+    bytes[2 * opcode + 1] = opcode & 0xFF;
+  }
+  constexpr uint64_t base = 0x10000;
+  const std::vector<SH::ListingRange> ranges = {
+      {base, base + 0x8001}, {base + 0x9000, base + 0x20000}};
+  const auto read = [&](const uint64_t addr, uint8_t *dest, const size_t len) {
+    std::copy_n(bytes.data() + (addr - base), len, dest);
+    return len;
+  };
+
+  std::string want;
+  for (const auto &r : ranges) {
+    SH::RenderListing(SH::SH_2E_ISA, BigEndian, bytes.data() + (r.start - base),
+                      r.end - r.start, r.start, {}, want);
+  }
+
+  std::ostringstream out;
+  uint64_t done = 0, total = 0;
+  const auto progress = [&](const uint64_t d, const uint64_t t) {
+    EXPECT_GT(d, done);
+    done = d;
+    total = t;
+    return true;
+  };
+  const SH::ListingOptions options = {
+      .render = {}, .threads = 4, .chunk = 0x1000};
+  SH::ListingStats stats;
+  ASSERT_TRUE(SH::WriteListing(SH::SH_2E_ISA, BigEndian, ranges, read, out,
+                               options, progress, stats));
+  EXPECT_EQ(out.str(), want);
+  EXPECT_EQ(done, total);
+  EXPECT_EQ(stats.input_bytes, 0x8001 + 0x17000);
+  EXPECT_EQ(stats.output_bytes, want.size());
+
+  // Cancelling stops after the first chunk
+  std::ostringstream cancelled;
+  EXPECT_FALSE(SH::WriteListing(
+      SH::SH_2E_ISA, BigEndian, ranges, read, cancelled, options,
+      [](uint64_t, uint64_t) { return false; }, stats));
+  EXPECT_EQ(stats.input_bytes, 0x1000);
+
+  // Bytes the reader could not read are neither listed nor counted
+  const auto short_read = [&](const uint64_t addr, uint8_t *dest,
+                              const size_t len) {
+    return read(addr, dest, len / 2);
+  };
+  std::ostringstream partial;
+  ASSERT_TRUE(SH::WriteListing(SH::SH_2E_ISA, BigEndian, ranges, short_read,
+                               partial, options, nullptr, stats));
+  EXPECT_EQ(stats.input_bytes, (8 + 23) * 0x800);  // the 1-byte chunk reads 0
+  EXPECT_EQ(stats.output_bytes, partial.str().size());
+
+  // A slow writer holds back the workers: when chunk w has been written,
+  // at most two chunks per thread past it have been read
+  std::atomic<size_t> reads{0};
+  const auto counted_read = [&](const uint64_t addr, uint8_t *dest,
+                                const size_t len) {
+    reads++;
+    return read(addr, dest, len);
+  };
+  size_t writes = 0;
+  const auto slow = [&](uint64_t, uint64_t) {
+    writes++;
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    EXPECT_LE(reads.load(), writes + 2 * options.threads);
+    return true;
+  };
+  std::ostringstream throttled;
+  ASSERT_TRUE(SH::WriteListing(SH::SH_2E_ISA, BigEndian, ranges, counted_read,
+                               throttled, options, slow, stats));
+  EXPECT_EQ(throttled.str(), want);
+}
+
+// Test that pool words are read from the view a page at a time, once until
+// invalidated
+TEST(TestPoolCache, TestRead) {
+  std::vector<uint8_t> bytes(0x3000);
+  for (size_t i = 0; i < bytes.size(); i++) {
+    bytes[i] = static_cast<uint8_t>(i);
+  }
+  constexpr uint64_t base = 0x10000;
+  const auto read = [&](const uint64_t addr, uint8_t *dest, const size_t len) {
+    if (addr < base || addr >= base + bytes.size()) {
+      return size_t{0};
+    }
+    const size_t n = std::min<size_t>(len, base + bytes.size() - addr);
+    std::copy_n(bytes.data() + (addr - base), n, dest);
+    return n;
+  };
+  SH::PoolCache cache(read);
+
+  EXPECT_EQ(cache.ReadWord(base + 0x10, 4, BigEndian), 0x10111213);
+  EXPECT_EQ(cache.ReadWord(base + 0x10, 4, LittleEndian), 0x13121110);
+  EXPECT_EQ(cache.ReadWord(base + 0x20, 2, BigEndian), 0x2021);
+  EXPECT_EQ(cache.GetPageReads(), 1);
+
+  // Straddles two pages
+  EXPECT_EQ(cache.ReadWord(base + 0xFFE, 4, BigEndian), 0xFEFF0001);
+  EXPECT_EQ(cache.GetPageReads(), 2);
+
+  bytes[0x10] = 0xAA;
+  EXPECT_EQ(cache.ReadWord(base + 0x10, 1, BigEndian), 0x10);
+  cache.Invalidate(base + 0x10, 1);
+  EXPECT_EQ(cache.ReadWord(base + 0x10, 1, BigEndian), 0xAA);
+  EXPECT_EQ(cache.GetPageReads(), 3);
+  EXPECT_EQ(cache.ReadWord(base + 0x1010, 1, BigEndian), 0x10);
+  EXPECT_EQ(cache.GetPageReads(), 3);
+
+  EXPECT_EQ(cache.ReadWord(base + 0x2FFE, 4, BigEndian), std::nullopt);
+  EXPECT_EQ(cache.ReadWord(0, 2, BigEndian), std::nullopt);
+}
+
+// Test the values PC-relative loads take from a pool
+TEST(TestPoolCache, TestPoolValue) {
+  const std::vector<uint8_t> bytes = {0x90, 0x01, 0xD1, 0x01, 0x00, 0x09,
+                                      0x80, 0x00, 0x12, 0x34, 0x56, 0x78};
+  SH::PoolCache cache(
+      [&](const uint64_t addr, uint8_t *dest, const size_t len) {
+        const size_t n = addr < bytes.size()
+                             ? std::min(len, bytes.size() - addr)
+                             : 0;
+        std::copy_n(bytes.data() + addr, n, dest);
+        return n;
+      });
+
+  SH::DecodedInsn insn;
+  ASSERT_TRUE(SH::DecodeInstruction(SH::SH_1_ISA, 0x9001, 0, insn));
+  EXPECT_EQ(SH::PoolValue(cache, insn, BigEndian), 0xFFFF8000);
+  ASSERT_TRUE(SH::DecodeInstruction(SH::SH_1_ISA, 0xD101, 2, insn));
+  EXPECT_EQ(SH::PoolValue(cache, insn, BigEndian), 0x12345678);
+  ASSERT_TRUE(SH::DecodeInstruction(SH::SH_1_ISA, 0x000B, 4, insn));
+  EXPECT_EQ(SH::PoolValue(cache, insn, BigEndian), std::nullopt);
+}
@@ -3,9 +3,10 @@
 
 #include <binaryninjaapi.h>
 
+#include "delay_slot.h"
 #include "flags.h"
 #include "instructions.h"
-#include "opcodes.h"
+#include "properties.h"
 #include "registers.h"
 
 #define TBIT                                                   \
@@ -45,8 +46,9 @@
 namespace SuperH {
 
 // Default Lift
-bool Instruction::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                       BN::LowLevelILFunction &il, BN::Architecture *arch) {
+bool Instruction::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                       BN::LowLevelILFunction &il,
+                       BN::Architecture *arch) const {
   il.AddInstruction(il.Unimplemented());
   len = length;
   return true;
@@ -88,27 +90,171 @@ static void ConditionalJump(BN::Architecture *arch, BN::LowLevelILFunction &il,
   il.AddInstruction(il.Jump(il.ConstPointer(addrSize, f)));
 }
 
-bool AddRmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                   BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [Rn, Rm] = GetNMFormatOpcodeFields(opcode);
+/*
+ * Lifts a delayed branch. The branch reads its operands and writes PR, then
+ * the instruction in its delay slot runs, then control transfers, so operands
+ * the slot overwrites are copied to temporaries first. `slot` is nullptr when
+ * the slot lies beyond the bytes being lifted; then only the branch is lifted.
+ */
+static bool LiftDelayedBranch(const DecodedInsn &insn, const DecodedInsn *slot,
+                              const uint64_t addr, size_t &len,
+                              BN::LowLevelILFunction &il,
+                              BN::Architecture *arch) {
+  uint64_t clobbered = 0;
+  if (slot != nullptr) {
+    clobbered = RegistersWritten(*slot);
+    // Comparisons and shifts set T without listing SR
+    if (PropertiesOf(*slot).writes_t) {
+      clobbered |= RegisterBit(Registers::SR);
+    }
+  }
+  uint32_t temps = 0;
+  // Register that holds the value `reg` had before the slot
+  const auto before_slot = [&](const uint32_t reg) {
+    if ((clobbered & RegisterBit(reg)) == 0) {
+      return reg;
+    }
+    const uint32_t temp = LLIL_TEMP(temps++);
+    il.AddInstruction(SETREG_L(temp, REG_L(reg)));
+    return temp;
+  };
+  const uint64_t next = addr + 2 * INSTRUCTION_SIZE;  // after the slot
+
+  uint32_t operand = 0;
+  switch (insn.id) {
+    case InsnId::BfsDisp:
+    case InsnId::BtsDisp:
+      operand = before_slot(Registers::SR);
+      break;
+    case InsnId::BrafRm:
+    case InsnId::JmpIndrRm:
+      operand = before_slot(insn.m);
+      break;
+    case InsnId::BsrfRm:
+    case InsnId::JsrIndrRm:
+      operand = before_slot(insn.m);
+      il.AddInstruction(
+          SETREG_L(Registers::PR, il.ConstPointer(Sizes::LONG, next)));
+      break;
+    case InsnId::BsrDisp:
+      il.AddInstruction(
+          SETREG_L(Registers::PR, il.ConstPointer(Sizes::LONG, next)));
+      break;
+    case InsnId::Rts:
+      operand = before_slot(Registers::PR);
+      break;
+    case InsnId::Rte:
+      // Pop PC, then SR
+      operand = LLIL_TEMP(temps++);
+      il.AddInstruction(SETREG_L(operand, LOAD_L(REG_L(Registers::R15))));
+      il.AddInstruction(SETREG_L(Registers::R15,
+                                 ADD_L(REG_L(Registers::R15), CONST_L(4))));
+      il.AddInstruction(SETREG_L(Registers::SR, LOAD_L(REG_L(Registers::R15))));
+      il.AddInstruction(SETREG_L(Registers::R15,
+                                 ADD_L(REG_L(Registers::R15), CONST_L(4))));
+      break;
+    default:
+      break;
+  }
+
+  len = INSTRUCTION_SIZE;
+  if (slot != nullptr) {
+    size_t slot_len = INSTRUCTION_SIZE;
+    il.SetCurrentAddress(arch, addr + INSTRUCTION_SIZE);
+    // The branch's own IL is already emitted, so a slot that cannot be
+    // lifted stands in as unimplemented and the branch still transfers
+    if (!DispatchLift(*slot, addr + INSTRUCTION_SIZE, slot_len, il, arch)) {
+      il.AddInstruction(il.Unimplemented());
+    }
+    il.SetCurrentAddress(arch, addr);
+    len = 2 * INSTRUCTION_SIZE;
+  }
+
+  switch (insn.id) {
+    case InsnId::BfsDisp:
+    case InsnId::BtsDisp: {
+      const auto t = il.And(Sizes::LONG, REG_L(operand), CONST_L(1));
+      const auto condition = il.CompareEqual(
+          Sizes::LONG, t, CONST_L(insn.id == InsnId::BtsDisp ? 1 : 0));
+      ConditionalJump(arch, il, condition, Sizes::LONG, insn.target, next);
+      break;
+    }
+    case InsnId::BraDisp:
+      if (auto *label = il.GetLabelForAddress(arch, insn.target)) {
+        il.AddInstruction(il.Goto(*label));
+      } else {
+        il.AddInstruction(
+            il.Jump(il.ConstPointer(Sizes::LONG, insn.target)));
+      }
+      break;
+    case InsnId::BsrDisp:
+      il.AddInstruction(il.Call(il.ConstPointer(Sizes::LONG, insn.target)));
+      break;
+    case InsnId::BrafRm:
+      il.AddInstruction(il.Jump(
+          ADD_L(il.ConstPointer(Sizes::LONG, next), REG_L(operand))));
+      break;
+    case InsnId::BsrfRm:
+      il.AddInstruction(il.Call(
+          ADD_L(il.ConstPointer(Sizes::LONG, next), REG_L(operand))));
+      break;
+    case InsnId::JmpIndrRm:
+      il.AddInstruction(il.Jump(REG_L(operand)));
+      break;
+    case InsnId::JsrIndrRm:
+      il.AddInstruction(il.Call(REG_L(operand)));
+      break;
+    case InsnId::Rts:
+    case InsnId::Rte:
+      il.AddInstruction(il.Return(REG_L(operand)));
+      break;
+    default:
+      il.AddInstruction(il.Unimplemented());
+      break;
+  }
+  return true;
+}
+
+bool LiftPair(const DecodedPair &pair, const uint64_t addr, size_t &len,
+              BN::LowLevelILFunction &il, BN::Architecture *arch) {
+  if (!pair.has_slot) {
+    len = Instruction::length;
+    return DispatchLift(pair.insn, addr, len, il, arch);
+  }
+  if (pair.slot_illegal) {
+    // The CPU raises a slot illegal instruction exception
+    il.AddInstruction(il.Undefined());
+    len = pair.length;
+    return true;
+  }
+  return LiftDelayedBranch(pair.insn,
+                           pair.slot != nullptr ? &pair.slot_insn : nullptr,
+                           addr, len, il, arch);
+}
+
+bool AddRmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                   BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  const auto Rn = insn.n;
+  const auto Rm = insn.m;
 
   il.AddInstruction(SETREG_L(Rn, ADD_L(REG_L(Rn), REG_L(Rm))));
   return true;
 }
 
-bool AddImmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                    BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [Rn, i] = ExtractNIFormatOpcodeFields(opcode);
-  const auto imm = static_cast<int8_t>(i);  // convert to signed int
+bool AddImmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                    BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  const auto Rn = insn.n;
+  const auto imm = insn.imm;  // sign-extended by the decoder
 
   il.AddInstruction(SETREG_L(Rn, ADD_L(REG_L(Rn), CONST_L(imm))));
   return true;
 }
 
-bool AddcRmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                    BN::LowLevelILFunction &il, BN::Architecture *arch) {
+bool AddcRmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                    BN::LowLevelILFunction &il, BN::Architecture *arch) const {
   BN::LowLevelILLabel t1, f1, done1, t2, done2;
-  const auto [Rn, Rm] = GetNMFormatOpcodeFields(opcode);
+  const auto Rn = insn.n;
+  const auto Rm = insn.m;
 
   const auto tmp0 = REG_L(Rn);
   const auto tmp1 = ADD_L(REG_L(Rn), REG_L(Rm));
@@ -146,9 +292,9 @@ bool AddcRmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
 // TODO: AndImmR0::Lift
 // TODO: AndbImmIndrR0Gbr::Lift
 
-bool BfDisp::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                  BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto target = BfDisp::GetTarget(opcode, addr);
+bool BfDisp::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                  BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  const auto target = insn.target;
   const auto condition =
       il.CompareEqual(Sizes::LONG, TBIT, il.Const(Sizes::LONG, 0));
 
@@ -156,19 +302,34 @@ bool BfDisp::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
   return true;
 }
 
-// TODO: BfsDisp::Lift
-// When we implement BfsDisp, we will need to somehow
-// get the next instruction's IL
-// Ref: https://github.com/Vector35/arch-mips/blob/master/arch_mips.cpp#L457
+bool BfsDisp::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                   BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
+}
 
-// TODO: BraDisp::Lift
-// TODO: BrafRm::Lift
-// TODO: BsrDisp::Lift
-// TODO: BsrfRm::Lift
+bool BraDisp::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                   BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
+}
 
-bool BtDisp::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                  BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto target = BtDisp::GetTarget(opcode, addr);
+bool BrafRm::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                  BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
+}
+
+bool BsrDisp::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                   BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
+}
+
+bool BsrfRm::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                  BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
+}
+
+bool BtDisp::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                  BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  const auto target = insn.target;
   const auto condition =
       il.CompareEqual(Sizes::LONG, TBIT, il.Const(Sizes::LONG, 1));
 
@@ -176,15 +337,15 @@ bool BtDisp::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
   return true;
 }
 
-// TODO: BtsDisp::Lift
-// When we implement BtsDisp, we will need to somehow
-// get the next instruction's IL
-// Ref: https://github.com/Vector35/arch-mips/blob/master/arch_mips.cpp#L457
+bool BtsDisp::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                   BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
+}
 
 // TODO: Clrmac::Lift
 
-bool Clrt::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                BN::LowLevelILFunction &il, BN::Architecture *arch) {
+bool Clrt::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                BN::LowLevelILFunction &il, BN::Architecture *arch) const {
   il.AddInstruction(CLRT);
   return true;
 }
@@ -210,19 +371,14 @@ bool Clrt::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
 // TODO: ExtubRmRn::Lift
 // TODO: ExtuwRmRn::Lift
 
-bool JmpIndrRm::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                     BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto m = GetMFormatOpcodeField(opcode);
-  il.AddInstruction(il.Jump(REG_L(m)));
-  return true;
+bool JmpIndrRm::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                     BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
 }
 
-bool JsrIndrRm::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                     BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto m = GetMFormatOpcodeField(opcode);
-  il.AddInstruction(SETREG_L(Registers::PR, REG_L(Registers::PC)));
-  il.AddInstruction(il.Call(REG_L(m)));
-  return true;
+bool JsrIndrRm::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                     BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
 }
 
 // TODO: LdcRmSr::Lift
@@ -241,86 +397,103 @@ bool JsrIndrRm::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
 // TODO: MacwIndrRmPostincIndrRnPostinc::Lift
 // TODO: MacIndrRmPostincIndrRnPostinc::Lift
 
-bool MovRmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                   BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovRmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                   BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(n, REG_L(m)));
   return true;
 }
 
-bool MovbRmIndrRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                        BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovbRmIndrRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                        BN::LowLevelILFunction &il,
+                        BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(STORE_B(REG_L(n), REG_B(m)));
   return true;
 }
 
-bool MovwRmIndrRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                        BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovwRmIndrRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                        BN::LowLevelILFunction &il,
+                        BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(STORE_W(REG_W(n), REG_W(m)));
   return true;
 }
 
-bool MovlRmIndrRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                        BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovlRmIndrRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                        BN::LowLevelILFunction &il,
+                        BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(STORE_L(REG_L(n), REG_L(m)));
   return true;
 }
 
-bool MovbIndrRmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                        BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovbIndrRmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                        BN::LowLevelILFunction &il,
+                        BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(n, il.SignExtend(Sizes::LONG, LOAD_B(REG_L(m)))));
   return true;
 }
 
-bool MovwIndrRmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                        BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovwIndrRmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                        BN::LowLevelILFunction &il,
+                        BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(n, il.SignExtend(Sizes::LONG, LOAD_W(REG_L(m)))));
   return true;
 }
 
-bool MovlIndrRmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                        BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovlIndrRmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                        BN::LowLevelILFunction &il,
+                        BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(n, LOAD_L(REG_L(m))));
   return true;
 }
 
-bool MovbRmIndrPredecRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                              BN::LowLevelILFunction &il,
-                              BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovbRmIndrPredecRn::Lift(const DecodedInsn &insn, uint64_t addr,
+                              size_t &len, BN::LowLevelILFunction &il,
+                              BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(STORE_B(SUB_L(REG_L(n), CONST_L(1)), REG_B(m)));
   il.AddInstruction(SETREG_L(n, SUB_L(REG_L(n), CONST_L(1))));
   return true;
 }
 
-bool MovwRmIndrPredecRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                              BN::LowLevelILFunction &il,
-                              BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovwRmIndrPredecRn::Lift(const DecodedInsn &insn, uint64_t addr,
+                              size_t &len, BN::LowLevelILFunction &il,
+                              BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(STORE_W(SUB_L(REG_L(n), CONST_L(1)), REG_W(m)));
   il.AddInstruction(SETREG_L(n, SUB_L(REG_L(n), CONST_L(2))));
   return true;
 }
 
-bool MovlRmIndrPredecRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                              BN::LowLevelILFunction &il,
-                              BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovlRmIndrPredecRn::Lift(const DecodedInsn &insn, uint64_t addr,
+                              size_t &len, BN::LowLevelILFunction &il,
+                              BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(STORE_L(SUB_L(REG_L(n), CONST_L(4)), REG_L(m)));
   il.AddInstruction(SETREG_L(n, SUB_L(REG_L(n), CONST_L(4))));
   return true;
 }
 
-bool MovbIndrRmPostincRn::Lift(const uint16_t opcode, uint64_t addr,
+bool MovbIndrRmPostincRn::Lift(const DecodedInsn &insn, uint64_t addr,
                                size_t &len, BN::LowLevelILFunction &il,
-                               BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+                               BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(n, il.SignExtend(Sizes::LONG, LOAD_B(REG_L(m)))));
   if (n != m) {
     il.AddInstruction(SETREG_L(m, ADD_L(REG_L(m), CONST_L(1))));
@@ -328,10 +501,11 @@ bool MovbIndrRmPostincRn::Lift(const uint16_t opcode, uint64_t addr,
   return true;
 }
 
-bool MovwIndrRmPostincRn::Lift(const uint16_t opcode, uint64_t addr,
+bool MovwIndrRmPostincRn::Lift(const DecodedInsn &insn, uint64_t addr,
                                size_t &len, BN::LowLevelILFunction &il,
-                               BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+                               BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(n, il.SignExtend(Sizes::LONG, LOAD_W(REG_L(m)))));
   if (n != m) {
     il.AddInstruction(SETREG_L(m, ADD_L(REG_L(m), CONST_L(2))));
@@ -339,10 +513,11 @@ bool MovwIndrRmPostincRn::Lift(const uint16_t opcode, uint64_t addr,
   return true;
 }
 
-bool MovlIndrRmPostincRn::Lift(const uint16_t opcode, uint64_t addr,
+bool MovlIndrRmPostincRn::Lift(const DecodedInsn &insn, uint64_t addr,
                                size_t &len, BN::LowLevelILFunction &il,
-                               BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+                               BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(n, LOAD_L(REG_L(m))));
   if (n != m) {
     il.AddInstruction(SETREG_L(m, ADD_L(REG_L(m), CONST_L(4))));
@@ -350,86 +525,96 @@ bool MovlIndrRmPostincRn::Lift(const uint16_t opcode, uint64_t addr,
   return true;
 }
 
-bool MovbRmIndrR0Rn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                          BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovbRmIndrR0Rn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                          BN::LowLevelILFunction &il,
+                          BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(STORE_B(ADD_L(REG_L(n), REG_L(Registers::R0)), REG_B(m)));
   return true;
 }
 
-bool MovwRmIndrR0Rn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                          BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovwRmIndrR0Rn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                          BN::LowLevelILFunction &il,
+                          BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(STORE_W(ADD_L(REG_L(n), REG_L(Registers::R0)), REG_W(m)));
   return true;
 }
 
-bool MovlRmIndrR0Rn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                          BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovlRmIndrR0Rn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                          BN::LowLevelILFunction &il,
+                          BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(STORE_L(ADD_L(REG_L(n), REG_L(Registers::R0)), REG_L(m)));
   return true;
 }
 
-bool MovbIndrR0RmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                          BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovbIndrR0RmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                          BN::LowLevelILFunction &il,
+                          BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(
       n, il.SignExtend(Sizes::LONG,
                        LOAD_B(ADD_L(REG_L(m), REG_L(Registers::R0))))));
   return true;
 }
 
-bool MovwIndrR0RmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                          BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovwIndrR0RmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                          BN::LowLevelILFunction &il,
+                          BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(
       n, il.SignExtend(Sizes::LONG,
                        LOAD_W(ADD_L(REG_L(m), REG_L(Registers::R0))))));
   return true;
 }
 
-bool MovlIndrR0RmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                          BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, m] = GetNMFormatOpcodeFields(opcode);
+bool MovlIndrR0RmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                          BN::LowLevelILFunction &il,
+                          BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
   il.AddInstruction(SETREG_L(n, LOAD_L(ADD_L(REG_L(m), REG_L(Registers::R0)))));
   return true;
 }
 
-bool MovImmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                    BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto [n, i] = ExtractNIFormatOpcodeFields(opcode);
-  il.AddInstruction(SETREG_L(n, il.SignExtend(Sizes::LONG, CONST_B(i))));
+bool MovImmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                    BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  const auto n = insn.n;
+  il.AddInstruction(SETREG_L(n, CONST_L(insn.imm)));
   return true;
 }
 
-bool MovwIndrDispPcRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
+bool MovwIndrDispPcRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
                             BN::LowLevelILFunction &il,
-                            BN::Architecture *arch) {
-  const auto [n, d] = ExtractND8FormatOpcodeFields(opcode);
-  const auto target =
-      (static_cast<uint64_t>(d) * 2) + addr + (2 * INSTRUCTION_SIZE);
+                            BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto target = insn.target;
 
   il.AddInstruction(SETREG_L(
       n, il.SignExtend(Sizes::LONG, LOAD_W(il.Const(Sizes::LONG, target)))));
   return true;
 }
 
-bool MovlIndrDispPcRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
+bool MovlIndrDispPcRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
                             BN::LowLevelILFunction &il,
-                            BN::Architecture *arch) {
-  const auto [n, d] = ExtractND8FormatOpcodeFields(opcode);
-  const auto target = (static_cast<uint64_t>(d) * 4) + (addr & 0xFFFFFFFC) +
-                      (2 * INSTRUCTION_SIZE);
+                            BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto target = insn.target;
 
   il.AddInstruction(SETREG_L(n, LOAD_L(il.Const(Sizes::LONG, target))));
   return true;
 }
 
-bool MovbIndrDispGbrR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                             BN::LowLevelILFunction &il,
-                             BN::Architecture *arch) {
-  const auto d = ExtractDFormatOpcodeFields(opcode);
+bool MovbIndrDispGbrR0::Lift(const DecodedInsn &insn, uint64_t addr,
+                             size_t &len, BN::LowLevelILFunction &il,
+                             BN::Architecture *arch) const {
+  const auto d = insn.imm;
 
   il.AddInstruction(SETREG_L(
       Registers::R0,
@@ -438,11 +623,10 @@ bool MovbIndrDispGbrR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
   return true;
 }
 
-bool MovwIndrDispGbrR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                             BN::LowLevelILFunction &il,
-                             BN::Architecture *arch) {
-  const auto d = ExtractDFormatOpcodeFields(opcode);
-  const auto target = static_cast<uint16_t>(d) * 2;
+bool MovwIndrDispGbrR0::Lift(const DecodedInsn &insn, uint64_t addr,
+                             size_t &len, BN::LowLevelILFunction &il,
+                             BN::Architecture *arch) const {
+  const auto target = insn.imm;
 
   il.AddInstruction(SETREG_L(
       Registers::R0,
@@ -451,82 +635,82 @@ bool MovwIndrDispGbrR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
   return true;
 }
 
-bool MovlIndrDispGbrR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                             BN::LowLevelILFunction &il,
-                             BN::Architecture *arch) {
-  const auto d = ExtractDFormatOpcodeFields(opcode);
-  const auto target = static_cast<uint32_t>(d) * 4;
+bool MovlIndrDispGbrR0::Lift(const DecodedInsn &insn, uint64_t addr,
+                             size_t &len, BN::LowLevelILFunction &il,
+                             BN::Architecture *arch) const {
+  const auto target = insn.imm;
 
   il.AddInstruction(SETREG_L(
       Registers::R0, LOAD_L(ADD_L(REG_L(Registers::GBR), CONST_L(target)))));
   return true;
 }
 
-bool MovbR0IndrDispGbr::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                             BN::LowLevelILFunction &il,
-                             BN::Architecture *arch) {
-  const auto d = ExtractDFormatOpcodeFields(opcode);
+bool MovbR0IndrDispGbr::Lift(const DecodedInsn &insn, uint64_t addr,
+                             size_t &len, BN::LowLevelILFunction &il,
+                             BN::Architecture *arch) const {
+  const auto d = insn.imm;
 
   il.AddInstruction(
       STORE_B(ADD_L(REG_L(Registers::GBR), CONST_L(d)), REG_B(Registers::R0)));
   return true;
 }
 
-bool MovwR0IndrDispGbr::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                             BN::LowLevelILFunction &il,
-                             BN::Architecture *arch) {
-  const auto d = ExtractDFormatOpcodeFields(opcode);
-  const auto target = static_cast<uint16_t>(d) * 2;
+bool MovwR0IndrDispGbr::Lift(const DecodedInsn &insn, uint64_t addr,
+                             size_t &len, BN::LowLevelILFunction &il,
+                             BN::Architecture *arch) const {
+  const auto target = insn.imm;
 
   il.AddInstruction(STORE_W(ADD_L(REG_L(Registers::GBR), CONST_L(target)),
                             REG_W(Registers::R0)));
   return true;
 }
 
-bool MovlR0IndrDispGbr::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                             BN::LowLevelILFunction &il,
-                             BN::Architecture *arch) {
-  const auto d = ExtractDFormatOpcodeFields(opcode);
-  const auto target = static_cast<uint32_t>(d) * 4;
+bool MovlR0IndrDispGbr::Lift(const DecodedInsn &insn, uint64_t addr,
+                             size_t &len, BN::LowLevelILFunction &il,
+                             BN::Architecture *arch) const {
+  const auto target = insn.imm;
 
   il.AddInstruction(STORE_L(ADD_L(REG_L(Registers::GBR), CONST_L(target)),
                             REG_L(Registers::R0)));
   return true;
 }
 
-bool MovbR0IndrDispRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
+bool MovbR0IndrDispRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
                             BN::LowLevelILFunction &il,
-                            BN::Architecture *arch) {
-  const auto [n, d] = ExtractND4FormatOpcodeFields(opcode);
+                            BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto d = insn.imm;
 
   il.AddInstruction(STORE_B(ADD_L(REG_L(n), CONST_L(d)), REG_B(Registers::R0)));
   return true;
 }
 
-bool MovwR0IndrDispRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
+bool MovwR0IndrDispRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
                             BN::LowLevelILFunction &il,
-                            BN::Architecture *arch) {
-  auto [n, d] = ExtractND4FormatOpcodeFields(opcode);
-  d *= 2;
+                            BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto d = insn.imm;
 
   il.AddInstruction(STORE_W(ADD_L(REG_L(n), CONST_L(d)), REG_W(Registers::R0)));
   return true;
 }
 
-bool MovlRmIndrDispRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
+bool MovlRmIndrDispRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
                             BN::LowLevelILFunction &il,
-                            BN::Architecture *arch) {
-  const auto [n, m, d] = ExtractNMDFormatOpcodeFields(opcode);
-  const auto target = (static_cast<uint32_t>(d) & 0xF) * 4;
+                            BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
+  const auto target = insn.imm;
 
   il.AddInstruction(STORE_L(ADD_L(REG_L(n), CONST_L(target)), REG_L(m)));
   return true;
 }
 
-bool MovbIndrDispRmR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
+bool MovbIndrDispRmR0::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
                             BN::LowLevelILFunction &il,
-                            BN::Architecture *arch) {
-  const auto [m, d] = ExtractMDFormatOpcodeFields(opcode);
+                            BN::Architecture *arch) const {
+  const auto m = insn.m;
+  const auto d = insn.imm;
 
   il.AddInstruction(SETREG_L(
       Registers::R0,
@@ -534,11 +718,11 @@ bool MovbIndrDispRmR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
   return true;
 }
 
-bool MovwIndrDispRmR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
+bool MovwIndrDispRmR0::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
                             BN::LowLevelILFunction &il,
-                            BN::Architecture *arch) {
-  auto [m, d] = ExtractMDFormatOpcodeFields(opcode);
-  d *= 2;
+                            BN::Architecture *arch) const {
+  const auto m = insn.m;
+  const auto d = insn.imm;
 
   il.AddInstruction(SETREG_L(
       Registers::R0,
@@ -546,32 +730,29 @@ bool MovwIndrDispRmR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
   return true;
 }
 
-bool MovlIndrDispRmRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
+bool MovlIndrDispRmRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
                             BN::LowLevelILFunction &il,
-                            BN::Architecture *arch) {
-  const auto [n, m, d] = ExtractNMDFormatOpcodeFields(opcode);
-  const auto target = (static_cast<uint32_t>(d) & 0xF) * 4;
+                            BN::Architecture *arch) const {
+  const auto n = insn.n;
+  const auto m = insn.m;
+  const auto target = insn.imm;
 
   il.AddInstruction(SETREG_L(n, LOAD_L(ADD_L(REG_L(m), CONST_L(target)))));
   return true;
 }
 
-bool MovaIndrDispPcR0::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
+bool MovaIndrDispPcR0::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
                             BN::LowLevelILFunction &il,
-                            BN::Architecture *arch) {
-  const auto n = GetNFormatOpcodeField(opcode);
-  const auto d = ExtractDFormatOpcodeFields(opcode);
-
-  const auto target = (static_cast<uint64_t>(d) * 4) + (addr & 0xFFFFFFFC) +
-                      (2 * INSTRUCTION_SIZE);
+                            BN::Architecture *arch) const {
+  const auto target = insn.target;
 
   il.AddInstruction(SETREG_L(Registers::R0, CONST_L(target)));
   return true;
 }
 
-bool MovtRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                  BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  const auto n = GetNFormatOpcodeField(opcode);
+bool MovtRn::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                  BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  const auto n = insn.n;
 
   il.AddInstruction(SETREG_L(n, TBIT));
   return true;
@@ -585,8 +766,8 @@ bool MovtRn::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
 // TODO: NegRmRn::Lift
 // TODO: NegcRmRn::Lift
 
-bool Nop::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-               BN::LowLevelILFunction &il, BN::Architecture *arch) {
+bool Nop::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+               BN::LowLevelILFunction &il, BN::Architecture *arch) const {
   il.AddInstruction(il.Nop());
   return true;
 }
@@ -599,16 +780,19 @@ bool Nop::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
 // TODO: RotcrRn::Lift
 // TODO: RotlRn::Lift
 // TODO: RotrRn::Lift
-// TODO: Rte::Lift
 
-bool Rts::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-               BN::LowLevelILFunction &il, BN::Architecture *arch) {
-  il.AddInstruction(il.Return(REG_L(Registers::PR)));
-  return true;
+bool Rte::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+               BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
 }
 
-bool Sett::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
-                BN::LowLevelILFunction &il, BN::Architecture *arch) {
+bool Rts::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+               BN::LowLevelILFunction &il, BN::Architecture *arch) const {
+  return LiftDelayedBranch(insn, nullptr, addr, len, il, arch);
+}
+
+bool Sett::Lift(const DecodedInsn &insn, uint64_t addr, size_t &len,
+                BN::LowLevelILFunction &il, BN::Architecture *arch) const {
   il.AddInstruction(SETT);
   return true;
 }
@@ -686,4 +870,11 @@ bool Sett::Lift(const uint16_t opcode, uint64_t addr, size_t &len,
 // TODO: StslFpulIndrPredecRn::Lift
 // TODO: StsFpscrRn::Lift
 // TODO: StslFpscrIndrPredecRn::Lift
+
+bool DispatchLift(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  BN::LowLevelILFunction &il, BN::Architecture *arch) {
+  return Visit(insn.id, [&](const auto &i) {
+    return i.Lift(insn, addr, len, il, arch);
+  });
+}
 }  // namespace SuperH
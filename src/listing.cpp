@@ -0,0 +1,282 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "listing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+#include "architecture.h"
+#include "fetch.h"
+
+namespace BN = BinaryNinja;
+
+namespace SuperH {
+// Longest line: address, opcode, text and newline
+constexpr size_t MAX_LINE = 8 + 2 + 4 + 2 + MAX_RENDERED_LENGTH + 1;
+
+// Writes the low `digits` nibbles of `value` as lowercase hex
+static char *PutHex(char *p, const uint64_t value, const int digits) {
+  constexpr std::string_view hex = "0123456789abcdef";
+  for (int d = digits - 1; d >= 0; d--) {
+    *p++ = hex[(value >> (4 * d)) & 0xF];
+  }
+  return p;
+}
+
+template <BNEndianness ENDIAN>
+static void RenderLines(const IsaType &t, const uint8_t *data,
+                        const size_t len, const uint64_t base,
+                        const RenderOptions &options, std::string &out) {
+  const size_t count = len / INSTRUCTION_SIZE;
+  size_t used = out.size();
+  out.resize(used + count * MAX_LINE + MAX_LINE);
+
+  DecodedInsn insn;
+  for (size_t i = 0; i < count; i++) {
+    const uint64_t addr = base + INSTRUCTION_SIZE * i;
+    const uint16_t opcode = FetchOpcode<ENDIAN>(data + INSTRUCTION_SIZE * i);
+    char *line = out.data() + used;
+    char *p = PutHex(line, addr, 8);
+    *p++ = ' ';
+    *p++ = ' ';
+    p = PutHex(p, opcode, 4);
+    *p++ = ' ';
+    *p++ = ' ';
+    if (DecodeInstruction(t, opcode, addr, insn)) {
+      p += RenderText(insn, {p, MAX_RENDERED_LENGTH}, options);
+    } else {
+      p = std::copy_n(".word 0x", 8, p);
+      p = PutHex(p, opcode, 4);
+    }
+    *p++ = '\n';
+    used = p - out.data();
+  }
+  if (len % INSTRUCTION_SIZE != 0) {
+    char *p = PutHex(out.data() + used, base + len - 1, 8);
+    p = std::copy_n("  ", 2, p);
+    p = PutHex(p, data[len - 1], 2);
+    p = std::copy_n("    .byte 0x", 12, p);
+    p = PutHex(p, data[len - 1], 2);
+    *p++ = '\n';
+    used = p - out.data();
+  }
+  out.resize(used);
+}
+
+void RenderListing(const IsaType &t, const BNEndianness endian,
+                   const uint8_t *data, const size_t len, const uint64_t base,
+                   const RenderOptions &options, std::string &out) {
+  if (endian == LittleEndian) {
+    RenderLines<LittleEndian>(t, data, len, base, options, out);
+  } else {
+    RenderLines<BigEndian>(t, data, len, base, options, out);
+  }
+}
+
+bool WriteListing(const IsaType &t, const BNEndianness endian,
+                  const std::vector<ListingRange> &ranges,
+                  const ListingReader &read, std::ostream &out,
+                  const ListingOptions &options,
+                  const ListingProgress &progress, ListingStats &stats) {
+  using Clock = std::chrono::steady_clock;
+  const auto start = Clock::now();
+
+  // Chunks never straddle a range, so each one starts on its own halfword
+  struct Chunk {
+    uint64_t start;
+    size_t len;
+    std::string text{};
+    size_t got = 0;  // bytes actually read, which may be fewer than `len`
+    bool done = false;
+  };
+  const size_t size = std::max<size_t>(
+      INSTRUCTION_SIZE, options.chunk & ~size_t{INSTRUCTION_SIZE - 1});
+  std::vector<Chunk> chunks;
+  uint64_t total = 0;
+  for (const auto &range : ranges) {
+    for (uint64_t a = range.start; a < range.end; a += size) {
+      chunks.push_back({.start = a,
+                        .len = static_cast<size_t>(
+                            std::min<uint64_t>(size, range.end - a))});
+    }
+    total += range.end - range.start;
+  }
+
+  unsigned threads = options.threads;
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  // Chunks rendered ahead of the writer at most, which bounds the memory
+  // held by text waiting to be written
+  const size_t in_flight = 2 * size_t{threads};
+
+  std::mutex mutex;
+  std::condition_variable finished;  // a chunk was rendered
+  std::condition_variable writable;  // a chunk was written, or stop was set
+  size_t written = 0;
+  std::atomic<size_t> next{0};
+  std::atomic<bool> stop{false};
+  const auto worker = [&] {
+    std::vector<uint8_t> bytes;
+    for (size_t c; !stop && (c = next.fetch_add(1)) < chunks.size();) {
+      {
+        std::unique_lock lock(mutex);
+        writable.wait(lock, [&] { return stop || c < written + in_flight; });
+      }
+      if (stop) {
+        break;
+      }
+      auto &chunk = chunks[c];
+      bytes.resize(chunk.len);
+      const size_t got = read(chunk.start, bytes.data(), chunk.len);
+      std::string text;
+      RenderListing(t, endian, bytes.data(), got, chunk.start, options.render,
+                    text);
+      // Drop the worst-case reservation while the chunk waits to be written
+      text.shrink_to_fit();
+      {
+        const std::lock_guard lock(mutex);
+        chunk.text = std::move(text);
+        chunk.got = got;
+        chunk.done = true;
+      }
+      finished.notify_one();
+    }
+  };
+
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < std::min<size_t>(threads, chunks.size()); i++) {
+    workers.emplace_back(worker);
+  }
+
+  // Write each chunk as soon as it and all before it are rendered
+  stats = ListingStats{};
+  bool ok = true;
+  uint64_t done = 0;
+  for (auto &chunk : chunks) {
+    std::string text;
+    {
+      std::unique_lock lock(mutex);
+      finished.wait(lock, [&] { return chunk.done; });
+      text = std::move(chunk.text);
+      written++;
+    }
+    writable.notify_all();
+    out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    done += chunk.len;
+    stats.input_bytes += chunk.got;
+    stats.output_bytes += text.size();
+    if (!out || (progress && !progress(done, total))) {
+      ok = false;
+      break;
+    }
+  }
+
+  // After a cancellation, workers finish their current chunk and exit
+  {
+    const std::lock_guard lock(mutex);
+    stop = true;
+  }
+  writable.notify_all();
+  for (auto &w : workers) {
+    w.join();
+  }
+  stats.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  return ok;
+}
+
+// Executable segments of the view, or all of it if it has none
+static std::vector<ListingRange> CodeRanges(BN::BinaryView *view) {
+  std::vector<ListingRange> ranges;
+  for (const auto &segment : view->GetSegments()) {
+    if (segment->GetFlags() & SegmentExecutable) {
+      ranges.push_back({segment->GetStart(), segment->GetEnd()});
+    }
+  }
+  if (ranges.empty()) {
+    ranges.push_back({view->GetStart(), view->GetEnd()});
+  }
+  std::sort(ranges.begin(), ranges.end(),
+            [](const auto &a, const auto &b) { return a.start < b.start; });
+  return ranges;
+}
+
+static Architecture *ViewArchitecture(BN::BinaryView *view) {
+  const auto arch = view->GetDefaultArchitecture();
+  return arch ? dynamic_cast<Architecture *>(arch.GetPtr()) : nullptr;
+}
+
+// `arch` is looked up when the command runs, since the view's default
+// architecture may change before the export starts. Registered
+// architectures are never freed.
+static void ExportListing(const BN::Ref<BN::BinaryView> view,
+                          const Architecture *arch, const std::string path) {
+  const BN::Ref<BN::BackgroundTask> task =
+      new BN::BackgroundTask("Exporting listing...", true);
+
+  std::ofstream out(path, std::ios::binary);
+  const auto read = [&](const uint64_t addr, uint8_t *dest, const size_t len) {
+    return view->Read(dest, addr, len);
+  };
+  int shown = -1;
+  const auto progress = [&](const uint64_t done, const uint64_t total) {
+    const int percent = total == 0 ? 100 : static_cast<int>(100 * done / total);
+    if (percent != shown) {
+      shown = percent;
+      task->SetProgressText("Exporting listing... " + std::to_string(percent) +
+                            "%");
+    }
+    return !task->IsCancelled();
+  };
+
+  // Same syntax as the disassembly, which the architecture fixed when the
+  // plugin loaded, even if the setting has changed since
+  ListingOptions options;
+  options.render.syntax = arch->syntax;
+
+  ListingStats stats;
+  const bool ok = out && WriteListing(arch->isa_type, arch->GetEndianness(),
+                                      CodeRanges(view), read, out, options,
+                                      progress, stats);
+  task->Finish();
+  if (!ok) {
+    BN::LogError("Listing export to %s failed or was cancelled", path.c_str());
+    return;
+  }
+  const double rate =
+      stats.seconds > 0 ? stats.input_bytes / 1e6 / stats.seconds : 0;
+  BN::LogInfo("Listed %llu bytes to %s (%llu bytes) in %.2f s, %.1f MB/s",
+              static_cast<unsigned long long>(stats.input_bytes), path.c_str(),
+              static_cast<unsigned long long>(stats.output_bytes),
+              stats.seconds, rate);
+}
+
+void RegisterListingCommand() {
+  BN::PluginCommand::Register(
+      "SuperH\\Export Listing...",
+      "Write a disassembly listing of the executable segments to a file",
+      [](BN::BinaryView *view) {
+        const auto arch = ViewArchitecture(view);
+        if (arch == nullptr) {
+          BN::LogError("Listing export needs a SuperH view");
+          return;
+        }
+        std::string path;
+        if (!BN::GetSaveFileNameInput(path, "Listing file", "*.txt",
+                                      "listing.txt")) {
+          return;
+        }
+        // Render in the background so that the UI stays responsive
+        std::thread(ExportListing, BN::Ref<BN::BinaryView>(view), arch, path)
+            .detach();
+      },
+      [](BN::BinaryView *view) { return ViewArchitecture(view) != nullptr; });
+}
+}  // namespace SuperH
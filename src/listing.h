@@ -0,0 +1,76 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_LISTING_H_
+#define SRC_LISTING_H_
+
+#include <binaryninjaapi.h>
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "instructions.h"
+#include "render.h"
+
+namespace SuperH {
+// Addresses [start, end) to list
+struct ListingRange {
+  uint64_t start;
+  uint64_t end;
+};
+
+struct ListingOptions {
+  RenderOptions render;
+  unsigned threads = 0;     // 0 for one per core
+  size_t chunk = 1 << 18;   // bytes rendered per task; rounded to halfwords
+};
+
+struct ListingStats {
+  uint64_t input_bytes;  // as returned by the reader
+  uint64_t output_bytes;
+  double seconds;
+};
+
+// Reads up to `len` bytes at `addr` into `dest` and returns how many were
+// read; called from several threads at once
+using ListingReader =
+    std::function<size_t(uint64_t addr, uint8_t *dest, size_t len)>;
+
+// Called on the writing thread with the bytes listed so far and in total;
+// returning false cancels the export
+using ListingProgress = std::function<bool(uint64_t done, uint64_t total)>;
+
+/*
+ * Appends one line per halfword of the `len` bytes at `data`, which are
+ * loaded at `base` in byte order `endian`: its address, opcode and text, e.g.
+ * "00001000  d103  MOV.L @0x1010,R1". Undefined opcodes are listed as .word
+ * and a trailing odd byte as .byte.
+ */
+void RenderListing(const IsaType &t, BNEndianness endian, const uint8_t *data,
+                   size_t len, uint64_t base, const RenderOptions &options,
+                   std::string &out);
+
+/*
+ * Writes the listing of `ranges` to `out` in address order. The ranges are
+ * split into chunks that worker threads read and render into their own
+ * buffers, while the calling thread writes finished chunks in order and
+ * reports progress. Workers render at most two chunks per thread ahead of
+ * the oldest chunk not yet taken by the writer, so at most that many chunks
+ * of text are held however slow `out` or `progress` is. Returns false if
+ * cancelled or if `out` failed.
+ */
+bool WriteListing(const IsaType &t, BNEndianness endian,
+                  const std::vector<ListingRange> &ranges,
+                  const ListingReader &read, std::ostream &out,
+                  const ListingOptions &options,
+                  const ListingProgress &progress, ListingStats &stats);
+
+// Registers the command that exports the listing of a view's executable
+// segments to a file
+void RegisterListingCommand();
+}  // namespace SuperH
+
+#endif  // SRC_LISTING_H_
@@ -21,7 +21,7 @@ std::vector<int> GetSimpleOpcodes() {
   std::vector<int> opcodes;
   opcodes.reserve(Opcodes::NAMES.size());
   for (const auto& [opcode, _] : Opcodes::NAMES) {
-    if (Opcodes::BRANCHING.find(opcode) == Opcodes::BRANCHING.end()) {
+    if (!Opcodes::IsBranching(opcode)) {
       opcodes.push_back(opcode);
     }
   }
@@ -4,12 +4,17 @@
 #ifndef SRC_OPCODES_H_
 #define SRC_OPCODES_H_
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
-#include <set>
-#include <string>
-#include <unordered_map>
+#include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "properties.h"
+#include "spec.h"
+
 namespace SuperH {
 
 namespace Opcodes {
@@ -129,62 +134,71 @@ constexpr uint16_t ExtsbRmRn = 0b0110 << 12 | 0b1110;
 // EXTS.W Rm,Rn         0110nnnnmmmm1111
 constexpr uint16_t ExtswRmRn = 0b0110 << 12 | 0b1111;
 
-static const std::unordered_map<uint16_t, std::string> NAMES = {
-    {AddRmRn, "ADD"},
-    {AddcRmRn, "ADDC"},
-    {AddvRmRn, "ADDV"},
-    {AndRmRn, "AND"},
-    {Clrmac, "CLRMAC"},
-    {Clrt, "CLRT"},
-    {CmpEqRmRn, "CMP/EQ"},
-    {CmpGeRmRn, "CMP/GE"},
-    {CmpGtRmRn, "CMP/GT"},
-    {CmpHiRmRn, "CMP/HI"},
-    {CmpHsRmRn, "CMP/HS"},
-    {CmpPlRn, "CMP/PL"},
-    {CmpPzRn, "CMP/PZ"},
-    {CmpStrRmRn, "CMP/STR"},
-    {Div0sRmRn, "DIV0S"},
-    {Div0u, "DIV0U"},
-    {Div1RmRn, "DIV1"},
-    {DmululRmRn, "DMULU.L"},
-    {DmulslRmRn, "DMULS.L"},
-    {DtRn, "DT"},
-    {ExtsbRmRn, "EXTS.B"},
-    {ExtswRmRn, "EXTS.W"},
-    {ExtubRmRn, "EXTU.B"},
-    {ExtuwRmRn, "EXTU.W"},
-    {MovRmRn, "MOV"},
-    {MovtRn, "MOVT"},
-    {MullRmRn, "MUL.L"},
-    {MulswRmRn, "MULS.W"},
-    {MuluwRmRn, "MULU.W"},
-    {NegRmRn, "NEG"},
-    {NegcRmRn, "NEGC"},
-    {Nop, "NOP"},
-    {NotRmRn, "NOT"},
-    {OrRmRn, "OR"},
-    {RotlRn, "ROTL"},
-    {RotcrRn, "ROTCR"},
-    {RotrRn, "ROTR"},
-    {Rte, "RTE"},
-    {Rts, "RTS"},
-    {Sett, "SETT"},
-    {ShalRn, "SHAL"},
-    {SharRn, "SHAR"},
-    {ShllRn, "SHLL"},
-    {ShlrRn, "SHLR"},
-    {SubRmRn, "SUB"},
-    {Sleep, "SLEEP"},
-    {SubcRmRn, "SUBC"},
-    {SubvRmRn, "SUBV"},
-    {SwapbRmRn, "SWAP.B"},
-    {SwapwRmRn, "SWAP.W"},
-    {TstRmRn, "TST"},
-    {XorRmRn, "XOR"},
-    {XtrctRmRn, "XTRCT"}};
-
-static const std::set BRANCHING = {Rte, Rts};
+struct OpcodeName {
+  uint16_t opcode;
+  std::string_view name;
+};
+
+// Sorts a table by opcode at compile time, so it can be binary searched
+template <size_t N>
+constexpr std::array<OpcodeName, N> SortedByOpcode(
+    std::array<OpcodeName, N> names) {
+  std::sort(names.begin(), names.end(),
+            [](const OpcodeName &a, const OpcodeName &b) {
+              return a.opcode < b.opcode;
+            });
+  return names;
+}
+
+// Opcode with every operand field zero and mnemonic of each instruction in
+// SPECS, so that the table cannot drift from the decoder
+inline constexpr auto NAMES = SortedByOpcode([] {
+  std::array<OpcodeName, SPECS.size()> names{};
+  for (size_t i = 0; i < SPECS.size(); i++) {
+    names[i] = {SPECS[i].Match(), SPECS[i].mnemonic};
+  }
+  return names;
+}());
+
+static_assert(std::adjacent_find(NAMES.begin(), NAMES.end(),
+                                 [](const OpcodeName &a, const OpcodeName &b) {
+                                   return a.opcode == b.opcode;
+                                 }) == NAMES.end());
+
+// Number of instructions in SPECS that branch, return or trap
+constexpr size_t CountBranching() {
+  size_t count = 0;
+  for (const auto &props : PROPERTIES) {
+    count += props.branch != BranchKind::NONE;
+  }
+  return count;
+}
+
+// Opcodes that end a block, sorted for IsBranching
+inline constexpr auto BRANCHING = [] {
+  std::array<uint16_t, CountBranching()> opcodes{};
+  size_t count = 0;
+  for (size_t i = 0; i < SPECS.size(); i++) {
+    if (PROPERTIES[i].branch != BranchKind::NONE) {
+      opcodes[count++] = SPECS[i].Match();
+    }
+  }
+  std::sort(opcodes.begin(), opcodes.end());
+  return opcodes;
+}();
+
+// Mnemonic of an opcode in NAMES, or an empty string
+constexpr std::string_view GetName(const uint16_t opcode) {
+  const auto it = std::lower_bound(
+      NAMES.begin(), NAMES.end(), opcode,
+      [](const OpcodeName &a, const uint16_t b) { return a.opcode < b; });
+  return it != NAMES.end() && it->opcode == opcode ? it->name
+                                                   : std::string_view{};
+}
+
+constexpr bool IsBranching(const uint16_t opcode) {
+  return std::binary_search(BRANCHING.begin(), BRANCHING.end(), opcode);
+}
 
 // Construct a list of all instructions
 std::vector<int> GetAllOpcodes();
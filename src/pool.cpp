@@ -0,0 +1,299 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "pool.h"
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "architecture.h"
+#include "hex.h"
+
+namespace BN = BinaryNinja;
+
+namespace SuperH {
+bool PoolCache::Read(uint64_t addr, uint8_t *dest, size_t len) {
+  while (len > 0) {
+    const size_t offset = addr % PAGE_SIZE;
+    const size_t n = std::min(len, PAGE_SIZE - offset);
+    const auto page = GetPage(addr / PAGE_SIZE);
+    if (offset + n <= page->valid) {
+      std::copy_n(page->bytes.data() + offset, n, dest);
+    } else if (read(addr, dest, n) != n) {
+      // A page that starts before the first readable byte holds nothing,
+      // so bytes past the start of a mid-page segment are read directly
+      return false;
+    }
+    addr += n;
+    dest += n;
+    len -= n;
+  }
+  return true;
+}
+
+std::optional<uint32_t> PoolCache::ReadWord(const uint64_t addr,
+                                            const size_t width,
+                                            const BNEndianness endian) {
+  std::array<uint8_t, 4> bytes{};
+  if (width > bytes.size() || !Read(addr, bytes.data(), width)) {
+    return std::nullopt;
+  }
+  uint32_t value = 0;
+  for (size_t i = 0; i < width; i++) {
+    const auto byte = endian == BigEndian ? bytes[i] : bytes[width - 1 - i];
+    value = value << 8 | byte;
+  }
+  return value;
+}
+
+void PoolCache::Invalidate(const uint64_t addr, const uint64_t len) {
+  if (len == 0) {
+    return;
+  }
+  const uint64_t first = addr / PAGE_SIZE;
+  const uint64_t last = (addr + std::min(len, UINT64_MAX - addr) - 1) /
+                        PAGE_SIZE;
+
+  const std::unique_lock lock(mutex);
+  generation++;
+  if (last - first >= pages.size()) {
+    std::erase_if(pages, [&](const auto &entry) {
+      return entry.first >= first && entry.first <= last;
+    });
+    return;
+  }
+  for (uint64_t index = first; index <= last; index++) {
+    pages.erase(index);
+  }
+}
+
+void PoolCache::Clear() {
+  const std::unique_lock lock(mutex);
+  generation++;
+  pages.clear();
+}
+
+std::shared_ptr<const PoolCache::Page> PoolCache::GetPage(
+    const uint64_t index) {
+  uint64_t seen;
+  {
+    const std::shared_lock lock(mutex);
+    if (const auto it = pages.find(index); it != pages.end()) {
+      return it->second;
+    }
+    seen = generation;
+  }
+
+  auto page = std::make_shared<Page>();
+  page->valid = read(index * PAGE_SIZE, page->bytes.data(), PAGE_SIZE);
+  page_reads.fetch_add(1, std::memory_order_relaxed);
+
+  // A page read while the view was being changed may already be stale, so
+  // it is used once but not kept
+  const std::unique_lock lock(mutex);
+  if (generation != seen) {
+    return page;
+  }
+  return pages.try_emplace(index, std::move(page)).first->second;
+}
+
+std::optional<uint32_t> PoolValue(PoolCache &cache, const DecodedInsn &insn,
+                                  const BNEndianness endian) {
+  if (insn.id == InsnId::MovwIndrDispPcRn) {
+    const auto value = cache.ReadWord(insn.target, 2, endian);
+    if (!value) {
+      return std::nullopt;
+    }
+    return static_cast<uint32_t>(static_cast<int16_t>(*value));
+  }
+  if (insn.id == InsnId::MovlIndrDispPcRn) {
+    return cache.ReadWord(insn.target, 4, endian);
+  }
+  return std::nullopt;
+}
+
+// The PoolCache of one view, cleared of whatever the view changes. It reads
+// through the view's core handle without holding a reference, so it must not
+// outlive the view; see PoolCaches.
+class ViewPoolCache final : public BN::BinaryDataNotification {
+ public:
+  explicit ViewPoolCache(BNBinaryView *view)
+      : cache([view](const uint64_t addr, uint8_t *dest, const size_t len) {
+          return BNReadViewData(view, dest, addr, len);
+        }) {}
+
+  void OnBinaryDataWritten(BN::BinaryView *, const uint64_t offset,
+                           const size_t len) override {
+    cache.Invalidate(offset, len);
+  }
+
+  // Inserting or removing bytes moves everything after them
+  void OnBinaryDataInserted(BN::BinaryView *, const uint64_t offset,
+                            size_t) override {
+    cache.Invalidate(offset, UINT64_MAX - offset);
+  }
+
+  void OnBinaryDataRemoved(BN::BinaryView *, const uint64_t offset,
+                           uint64_t) override {
+    cache.Invalidate(offset, UINT64_MAX - offset);
+  }
+
+  void OnSegmentAdded(BN::BinaryView *, BN::Segment *) override {
+    cache.Clear();
+  }
+
+  void OnSegmentRemoved(BN::BinaryView *, BN::Segment *) override {
+    cache.Clear();
+  }
+
+  void OnSegmentUpdated(BN::BinaryView *, BN::Segment *) override {
+    cache.Clear();
+  }
+
+  PoolCache cache;
+};
+
+/*
+ * The PoolCaches of the open views. They are keyed by core handle, since
+ * every BN::BinaryView wrapper of a view is a new object, and each is
+ * unregistered and freed when its view is destroyed, so that a later view at
+ * the same address starts empty. A caller holds a reference to the view for
+ * as long as it uses the view's cache.
+ */
+class PoolCaches final : public BN::ObjectDestructionNotification {
+ public:
+  PoolCache &For(BN::BinaryView *view) {
+    const std::lock_guard lock(mutex);
+    auto &entry = caches[view->GetObject()];
+    if (!entry) {
+      entry = std::make_unique<ViewPoolCache>(view->GetObject());
+      view->RegisterNotification(entry.get());
+    }
+    return entry->cache;
+  }
+
+  void DestructBinaryView(BN::BinaryView *view) override {
+    std::unique_ptr<ViewPoolCache> entry;
+    {
+      const std::lock_guard lock(mutex);
+      const auto it = caches.find(view->GetObject());
+      if (it == caches.end()) {
+        return;
+      }
+      entry = std::move(it->second);
+      caches.erase(it);
+    }
+    view->UnregisterNotification(entry.get());
+  }
+
+ private:
+  std::mutex mutex;
+  std::unordered_map<BNBinaryView *, std::unique_ptr<ViewPoolCache>> caches;
+};
+
+static PoolCache &PoolCacheFor(BN::BinaryView *view) {
+  // Never destroyed, as views may outlive static destruction
+  static auto *const caches = new PoolCaches();
+  return caches->For(view);
+}
+
+// Longest string shown after a pointer to it
+constexpr size_t MAX_STRING = 48;
+
+// Quotes `text`, escaping quotes, backslashes and unprintable bytes
+static std::string QuoteString(const std::string &text) {
+  std::string quoted = "\"";
+  for (const char c : text) {
+    const auto byte = static_cast<uint8_t>(c);
+    if (c == '"' || c == '\\') {
+      quoted += '\\';
+      quoted += c;
+    } else if (byte < 0x20 || byte > 0x7E) {
+      quoted += "\\x";
+      quoted += "0123456789abcdef"[byte >> 4];
+      quoted += "0123456789abcdef"[byte & 0xF];
+    } else {
+      quoted += c;
+    }
+  }
+  return quoted + '"';
+}
+
+// Appends the symbol at `value`, or the string there, if any
+static void AppendPointee(BN::BinaryView *view, PoolCache &cache,
+                          const uint32_t value,
+                          std::vector<BN::InstructionTextToken> &tokens) {
+  if (const auto symbol = view->GetSymbolByAddress(value)) {
+    tokens.emplace_back(TextToken, " ");
+    tokens.emplace_back(symbol->GetType() == FunctionSymbol ? CodeSymbolToken
+                                                            : DataSymbolToken,
+                        symbol->GetShortName(), value);
+    return;
+  }
+
+  BNStringReference ref;
+  if (!view->GetStringAtAddress(value, ref) ||
+      (ref.type != AsciiString && ref.type != Utf8String)) {
+    return;
+  }
+  std::string text(std::min(ref.length, MAX_STRING), '\0');
+  if (!cache.Read(ref.start, reinterpret_cast<uint8_t *>(text.data()),
+                  text.size())) {
+    return;
+  }
+  tokens.emplace_back(TextToken, " ");
+  tokens.emplace_back(StringToken, QuoteString(text), ref.start);
+  if (ref.length > MAX_STRING) {
+    tokens.emplace_back(TextToken, "...");
+  }
+}
+
+// Appends "; value" to every PC-relative MOV.W and MOV.L of a block, with
+// the symbol or string a MOV.L constant points to
+class PoolAnnotationLayer final : public BN::RenderLayer {
+ public:
+  PoolAnnotationLayer() : RenderLayer("SuperH Literal Pool Constants") {}
+
+  void ApplyToDisassemblyBlock(
+      const BN::Ref<BN::BasicBlock> block,
+      std::vector<BN::DisassemblyTextLine> &lines) override {
+    const auto arch =
+        dynamic_cast<Architecture *>(block->GetArchitecture().GetPtr());
+    if (arch == nullptr) {
+      return;
+    }
+    const auto view = block->GetFunction()->GetView();
+    auto &cache = PoolCacheFor(view);
+    const auto endian = arch->GetEndianness();
+
+    for (auto &line : lines) {
+      const auto opcode = cache.ReadWord(line.addr, INSTRUCTION_SIZE, endian);
+      DecodedInsn insn;
+      if (!opcode ||
+          !DecodeInstruction(arch->isa_type, *opcode, line.addr, insn)) {
+        continue;
+      }
+      const auto value = PoolValue(cache, insn, endian);
+      if (!value) {
+        continue;
+      }
+
+      line.tokens.emplace_back(TextToken, "  ; ");
+      if (insn.id == InsnId::MovwIndrDispPcRn) {
+        line.tokens.emplace_back(IntegerToken, FormatHex(*value), *value);
+        continue;
+      }
+      line.tokens.emplace_back(PossibleAddressToken, FormatAddress(*value),
+                               *value);
+      AppendPointee(view, cache, *value, line.tokens);
+    }
+  }
+};
+
+void RegisterPoolAnnotations() {
+  BN::RenderLayer::Register(new PoolAnnotationLayer(),
+                            EnabledByDefaultRenderLayerDefaultEnableState);
+}
+}  // namespace SuperH
@@ -0,0 +1,83 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_POOL_H_
+#define SRC_POOL_H_
+
+#include <binaryninjaapi.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "instructions.h"
+
+namespace SuperH {
+/*
+ * Bytes of a view read a page at a time and kept until the view changes, so
+ * that the constants of literal pools (and the loads that reference them)
+ * are read from the view once however often they are rendered. The owner
+ * calls Invalidate when the view's data changes. Safe to use from several
+ * threads.
+ */
+class PoolCache {
+ public:
+  static constexpr size_t PAGE_SIZE = 0x1000;
+
+  // Reads up to `len` bytes at `addr` into `dest` and returns how many were
+  // read
+  using Reader =
+      std::function<size_t(uint64_t addr, uint8_t *dest, size_t len)>;
+
+  explicit PoolCache(Reader read) : read(std::move(read)) {}
+
+  // Copies the `len` bytes at `addr` to `dest`. Returns false, leaving
+  // `dest` unspecified, if any of them cannot be read.
+  bool Read(uint64_t addr, uint8_t *dest, size_t len);
+
+  // Reads the `width`-byte (1, 2 or 4) word at `addr` stored in byte order
+  // `endian`
+  std::optional<uint32_t> ReadWord(uint64_t addr, size_t width,
+                                   BNEndianness endian);
+
+  // Forgets the pages overlapping `len` bytes at `addr`
+  void Invalidate(uint64_t addr, uint64_t len);
+
+  void Clear();
+
+  // Pages read from the view so far
+  [[nodiscard]] uint64_t GetPageReads() const {
+    return page_reads.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Page {
+    std::array<uint8_t, PAGE_SIZE> bytes;
+    size_t valid;  // bytes read from the start of the page
+  };
+
+  std::shared_ptr<const Page> GetPage(uint64_t index);
+
+  Reader read;
+  std::shared_mutex mutex;
+  std::unordered_map<uint64_t, std::shared_ptr<const Page>> pages;
+  uint64_t generation = 0;  // bumped by every invalidation
+  std::atomic<uint64_t> page_reads{0};
+};
+
+// Value a PC-relative MOV.W or MOV.L loads into its register, with MOV.W
+// sign-extended, or nothing for other instructions and unreadable pools
+std::optional<uint32_t> PoolValue(PoolCache &cache, const DecodedInsn &insn,
+                                  BNEndianness endian);
+
+// Registers the render layer that shows the constants PC-relative loads
+// read from literal pools, with the symbol or string they point to
+void RegisterPoolAnnotations();
+}  // namespace SuperH
+
+#endif  // SRC_POOL_H_
@@ -0,0 +1,311 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_PROPERTIES_H_
+#define SRC_PROPERTIES_H_
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+
+#include "instructions.h"
+#include "registers.h"
+#include "spec.h"
+
+namespace SuperH {
+enum class BranchKind : uint8_t {
+  NONE,
+  JUMP,         // BRA, BRAF, JMP
+  CONDITIONAL,  // BT, BF, BT/S, BF/S
+  CALL,         // BSR, BSRF, JSR
+  RETURN,       // RTS, RTE
+  TRAP,         // TRAPA
+};
+
+// Bit of a register in the masks below, indexed by its Registers:: id
+constexpr uint64_t RegisterBit(const uint32_t reg) {
+  return uint64_t{1} << reg;
+}
+
+// Id of a control or system register operand, e.g. "GBR"
+constexpr uint32_t ControlRegister(const std::string_view name) {
+  if (name == "SR") {
+    return Registers::SR;
+  } else if (name == "GBR") {
+    return Registers::GBR;
+  } else if (name == "VBR") {
+    return Registers::VBR;
+  } else if (name == "MACH") {
+    return Registers::MACH;
+  } else if (name == "MACL") {
+    return Registers::MACL;
+  } else if (name == "PR") {
+    return Registers::PR;
+  } else if (name == "FPUL") {
+    return Registers::FPUL;
+  }
+  return Registers::FPSCR;
+}
+
+/*
+ * Facts about an instruction that analyses need without decoding its
+ * semantics. Registers named by the n and m fields of an opcode depend on the
+ * decode, so they are described by n_use/m_use and resolved by RegistersRead
+ * and RegistersWritten.
+ */
+struct InsnProperties {
+  enum FieldUse : uint8_t {
+    READ = 1 << 0,
+    WRITE = 1 << 1,
+  };
+
+  BranchKind branch;
+  bool delay_slot;       // the next instruction executes before the branch
+  bool illegal_in_slot;  // raises a slot illegal instruction exception
+  bool reads_t;
+  bool writes_t;
+  uint8_t mem_width;  // bytes per memory access, or 0
+  uint8_t n_use, m_use;
+  uint8_t n_base, m_base;  // Registers::R0 or Registers::FR0
+  uint64_t reads;          // registers read apart from the n and m fields
+  uint64_t writes;         // registers written apart from the n and m fields
+};
+
+constexpr InsnProperties PropertiesOf(const InstructionSpec &spec) {
+  InsnProperties props{.branch = BranchKind::NONE,
+                       .delay_slot = false,
+                       .illegal_in_slot = false,
+                       .reads_t = false,
+                       .writes_t = false,
+                       .mem_width = 0,
+                       .n_use = 0,
+                       .m_use = 0,
+                       .n_base = Registers::R0,
+                       .m_base = Registers::R0,
+                       .reads = 0,
+                       .writes = 0};
+  const auto mnemonic = spec.mnemonic;
+  const auto is = [&mnemonic](const std::string_view s) {
+    return mnemonic == s;
+  };
+  const auto is_any = [&is](const std::initializer_list<std::string_view> s) {
+    for (const auto m : s) {
+      if (is(m)) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // Registers read by an operand, or written if it is a plain register
+  const auto use = [&props](const std::string_view op, const bool write) {
+    const auto mark = [&](const char field, const uint8_t how) {
+      (field == 'n' ? props.n_use : props.m_use) |= how;
+    };
+    const auto is_reg = [](const std::string_view r) {
+      return r == "Rn" || r == "Rm" || r == "R0";
+    };
+    const auto reg = [&](const std::string_view r, const uint8_t how) {
+      if (r == "R0") {
+        (how & InsnProperties::WRITE ? props.writes : props.reads) |=
+            RegisterBit(Registers::R0);
+      } else {
+        mark(r.back(), how);
+      }
+    };
+
+    if (op.starts_with("FR")) {
+      if (op == "FR0") {
+        (write ? props.writes : props.reads) |= RegisterBit(Registers::FR0);
+      } else {
+        (op.back() == 'n' ? props.n_base : props.m_base) = Registers::FR0;
+        mark(op.back(), write ? InsnProperties::WRITE : InsnProperties::READ);
+      }
+    } else if (is_reg(op)) {
+      reg(op, write ? InsnProperties::WRITE : InsnProperties::READ);
+    } else if (op.starts_with("@(")) {
+      // @(disp,Rn), @(R0,Rn), @(disp,GBR), @(R0,GBR) or @(disp,PC)
+      const auto comma = op.find(',');
+      const auto base = op.substr(comma + 1, op.size() - comma - 2);
+      if (op.starts_with("@(R0,")) {
+        props.reads |= RegisterBit(Registers::R0);
+      }
+      if (base == "GBR") {
+        props.reads |= RegisterBit(Registers::GBR);
+      } else if (base == "PC") {
+        props.reads |= RegisterBit(Registers::PC);
+      } else {
+        reg(base, InsnProperties::READ);
+      }
+    } else if (op.starts_with("@-")) {
+      reg(op.substr(2), InsnProperties::READ | InsnProperties::WRITE);
+    } else if (op.starts_with("@") && op.ends_with("+")) {
+      reg(op.substr(1, op.size() - 2),
+          InsnProperties::READ | InsnProperties::WRITE);
+    } else if (op.starts_with("@")) {
+      reg(op.substr(1), InsnProperties::READ);
+    } else if (op == "label") {
+      props.reads |= RegisterBit(Registers::PC);
+    } else if (op != "#imm") {
+      (write ? props.writes : props.reads) |= RegisterBit(ControlRegister(op));
+    }
+  };
+
+  // The last operand is the destination and the rest are sources
+  std::string_view ops = spec.operands;
+  bool has_memory = false;
+  while (!ops.empty()) {
+    size_t end = 0;
+    for (int depth = 0; end < ops.size(); end++) {
+      depth += ops[end] == '(' ? 1 : ops[end] == ')' ? -1 : 0;
+      if (ops[end] == ',' && depth == 0) {
+        break;
+      }
+    }
+    const auto op = ops.substr(0, end);
+    has_memory |= op.starts_with("@");
+    use(op, end == ops.size());
+    ops = ops.substr(end == ops.size() ? end : end + 1);
+  }
+
+  // Single register operands are usually modified in place, except for the
+  // branch targets of BRAF and BSRF
+  if (spec.operands == "Rn" || spec.operands == "FRn") {
+    props.n_use = InsnProperties::READ | InsnProperties::WRITE;
+  }
+  if (spec.operands == "Rm") {
+    props.m_use = InsnProperties::READ;
+  }
+  if (is_any({"CMP/PZ", "CMP/PL"})) {
+    props.n_use = InsnProperties::READ;
+  }
+  if (is_any({"MOVT", "FLDI0", "FLDI1"})) {
+    props.n_use = InsnProperties::WRITE;
+  }
+
+  // Arithmetic also reads its destination, and comparisons only read it
+  if (is_any({"ADD", "ADDC", "ADDV", "SUB", "SUBC", "SUBV", "AND", "OR", "XOR",
+              "DIV1", "XTRCT", "FADD", "FSUB", "FMUL", "FDIV", "FMAC"})) {
+    props.n_use |= InsnProperties::READ;
+    if (spec.operands.ends_with("R0")) {
+      props.reads |= RegisterBit(Registers::R0);
+    }
+  }
+  if (mnemonic.starts_with("CMP/") || mnemonic.starts_with("FCMP/") ||
+      is_any({"TST", "DIV0S", "MUL.L", "MULS.W", "MULU.W", "DMULS.L",
+              "DMULU.L", "MAC.W", "MAC.L"})) {
+    props.n_use = (props.n_use & ~InsnProperties::WRITE) | InsnProperties::READ;
+    props.writes &= ~RegisterBit(Registers::R0);
+    if (spec.operands.ends_with("R0")) {
+      props.reads |= RegisterBit(Registers::R0);
+    }
+  }
+  if (is_any({"MAC.W", "MAC.L"})) {
+    props.n_use |= InsnProperties::WRITE;
+    props.reads |= RegisterBit(Registers::MACH) | RegisterBit(Registers::MACL);
+  }
+  if (is_any({"MAC.W", "MAC.L", "DMULS.L", "DMULU.L", "CLRMAC"})) {
+    props.writes |= RegisterBit(Registers::MACH) | RegisterBit(Registers::MACL);
+  }
+  if (is_any({"MUL.L", "MULS.W", "MULU.W"})) {
+    props.writes |= RegisterBit(Registers::MACL);
+  }
+
+  // Memory accesses, except where an @ operand is only an address
+  if (has_memory && !is_any({"JMP", "JSR", "MOVA"})) {
+    props.mem_width = mnemonic.ends_with(".B")   ? 1
+                      : mnemonic.ends_with(".W") ? 2
+                                                 : 4;
+  }
+
+  // Control flow
+  if (is_any({"BRA", "BRAF", "JMP"})) {
+    props.branch = BranchKind::JUMP;
+  } else if (is_any({"BT", "BF", "BT/S", "BF/S"})) {
+    props.branch = BranchKind::CONDITIONAL;
+    props.reads_t = true;
+  } else if (is_any({"BSR", "BSRF", "JSR"})) {
+    props.branch = BranchKind::CALL;
+    props.writes |= RegisterBit(Registers::PR);
+  } else if (is_any({"RTS", "RTE"})) {
+    props.branch = BranchKind::RETURN;
+  } else if (is("TRAPA")) {
+    props.branch = BranchKind::TRAP;
+  }
+  if (props.branch != BranchKind::NONE) {
+    props.delay_slot = !is_any({"BT", "BF", "TRAPA"});
+    props.illegal_in_slot = true;
+    props.reads |= RegisterBit(Registers::PC);
+    props.writes |= RegisterBit(Registers::PC);
+  }
+  if (is("RTS")) {
+    props.reads |= RegisterBit(Registers::PR);
+  }
+  if (is("RTE")) {
+    // Pops PC and SR from the stack
+    props.mem_width = 4;
+    props.reads |= RegisterBit(Registers::R15);
+    props.writes |= RegisterBit(Registers::R15) | RegisterBit(Registers::SR);
+  }
+  if (is("TRAPA")) {
+    // Pushes SR and PC, then loads PC from the vector table
+    props.mem_width = 4;
+    props.reads |= RegisterBit(Registers::R15) | RegisterBit(Registers::SR) |
+                   RegisterBit(Registers::VBR);
+    props.writes |= RegisterBit(Registers::R15);
+  }
+
+  // The T bit
+  const auto sr = RegisterBit(Registers::SR);
+  props.reads_t |=
+      (props.reads & sr) != 0 ||
+      is_any({"ADDC", "SUBC", "NEGC", "ROTCL", "ROTCR", "DIV1", "MOVT"});
+  props.writes_t =
+      (props.writes & sr) != 0 || mnemonic.starts_with("CMP/") ||
+      mnemonic.starts_with("FCMP/") ||
+      is_any({"TST", "TST.B", "TAS.B", "ADDC", "ADDV", "SUBC", "SUBV", "NEGC",
+              "DIV0S", "DIV0U", "DIV1", "SHAL", "SHAR", "SHLL", "SHLR", "ROTL",
+              "ROTR", "ROTCL", "ROTCR", "DT", "CLRT", "SETT"});
+  return props;
+}
+
+// Properties of every instruction, indexed like SPECS
+inline constexpr auto PROPERTIES = [] {
+  std::array<InsnProperties, SPECS.size()> properties{};
+  for (size_t i = 0; i < SPECS.size(); i++) {
+    properties[i] = PropertiesOf(SPECS[i]);
+  }
+  return properties;
+}();
+
+constexpr const InsnProperties &PropertiesOf(const DecodedInsn &insn) {
+  return PROPERTIES[static_cast<size_t>(insn.id)];
+}
+
+constexpr uint64_t RegistersRead(const DecodedInsn &insn) {
+  const auto &props = PropertiesOf(insn);
+  auto regs = props.reads;
+  if (props.n_use & InsnProperties::READ) {
+    regs |= RegisterBit(props.n_base + insn.n);
+  }
+  if (props.m_use & InsnProperties::READ) {
+    regs |= RegisterBit(props.m_base + insn.m);
+  }
+  return regs;
+}
+
+constexpr uint64_t RegistersWritten(const DecodedInsn &insn) {
+  const auto &props = PropertiesOf(insn);
+  auto regs = props.writes;
+  if (props.n_use & InsnProperties::WRITE) {
+    regs |= RegisterBit(props.n_base + insn.n);
+  }
+  if (props.m_use & InsnProperties::WRITE) {
+    regs |= RegisterBit(props.m_base + insn.m);
+  }
+  return regs;
+}
+}  // namespace SuperH
+
+#endif  // SRC_PROPERTIES_H_
@@ -6,7 +6,7 @@
 
 #include <array>
 #include <cstdint>
-#include <string>
+#include <string_view>
 
 namespace SuperH::Registers {
 // 32-bit general registers R0-R15, used for data processing and address
@@ -65,7 +65,22 @@ constexpr uint32_t FR15 = 38;
 constexpr uint32_t FPUL = 39;
 constexpr uint32_t FPSCR = 40;
 
-std::string to_string(uint32_t rid);
+// Names of every register, indexed by id
+inline constexpr std::array<std::string_view, FPSCR + 1> NAMES = {
+    "R0",    "R1",   "R2",   "R3",   "R4",   "R5",   "R6",   "R7",
+    "R8",    "R9",   "R10",  "R11",  "R12",  "R13",  "R14",  "R15",
+    "SR",    "GBR",  "VBR",  "MACH", "MACL", "PR",   "PC",   "FR0",
+    "FR1",   "FR2",  "FR3",  "FR4",  "FR5",  "FR6",  "FR7",  "FR8",
+    "FR9",   "FR10", "FR11", "FR12", "FR13", "FR14", "FR15", "FPUL",
+    "FPSCR"};
+
+static_assert(NAMES[R15] == "R15" && NAMES[PC] == "PC" && NAMES[FR0] == "FR0" &&
+              NAMES[FPSCR] == "FPSCR");
+
+// Name of a register, or an empty string for an unknown id
+constexpr std::string_view GetName(const uint32_t rid) {
+  return rid < NAMES.size() ? NAMES[rid] : std::string_view{};
+}
 }  // namespace SuperH::Registers
 
 #endif  // SRC_REGISTERS_H_
@@ -0,0 +1,30 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#include "render.h"
+
+#include <type_traits>
+
+#include "syntax.h"
+
+namespace SuperH {
+template <class SYNTAX>
+static size_t Render(const DecodedInsn &insn, const std::span<char> out,
+                     const bool lowercase) {
+  TextWriter w(out);
+  size_t len = INSTRUCTION_SIZE;
+  DispatchText<SYNTAX>(insn, 0, len, w);
+  if (!SYNTAX::LOWERCASE && lowercase) {
+    w.Lowercase();
+  }
+  return w.Length();
+}
+
+size_t RenderText(const DecodedInsn &insn, const std::span<char> out,
+                  const RenderOptions options) {
+  return WithSyntax(options.syntax, [&](const auto policy) {
+    return Render<std::decay_t<decltype(policy)>>(insn, out,
+                                                  options.lowercase);
+  });
+}
+}  // namespace SuperH
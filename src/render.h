@@ -0,0 +1,91 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_RENDER_H_
+#define SRC_RENDER_H_
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "instructions.h"
+#include "syntax.h"
+
+namespace SuperH {
+/*
+ * Plain-text output of the text.cpp formatters: DispatchText writes the text
+ * of each token here instead of creating it. Writes into a caller's buffer
+ * and remembers whether anything did not fit.
+ */
+class TextWriter {
+ public:
+  explicit TextWriter(const std::span<char> out)
+      : begin(out.data()), pos(out.data()), end(out.data() + out.size()) {}
+
+  void Put(const std::string_view text) {
+    if (static_cast<size_t>(end - pos) < text.size()) {
+      overflow = true;
+      return;
+    }
+    pos = std::copy(text.begin(), text.end(), pos);
+  }
+
+  template <class T>
+  void PutNumber(const T value, const int base) {
+    const auto [ptr, ec] = std::to_chars(pos, end, value, base);
+    if (ec != std::errc{}) {
+      overflow = true;
+      return;
+    }
+    pos = ptr;
+  }
+
+  // Same text as FormatHex and FormatAddress, without the std::string
+  void PutHex(const uint64_t value, const bool prefix_zero) {
+    if (value == 0 && !prefix_zero) {
+      Put("0");
+      return;
+    }
+    Put("0x");
+    PutNumber(value, 16);
+  }
+
+  void Lowercase() {
+    for (char *p = begin; p != pos; p++) {
+      *p = *p >= 'A' && *p <= 'Z' ? static_cast<char>(*p - 'A' + 'a') : *p;
+    }
+  }
+
+  // Characters written, or 0 after an overflow
+  [[nodiscard]] size_t Length() const { return overflow ? 0 : pos - begin; }
+
+ private:
+  char *begin;
+  char *pos;
+  char *end;
+  bool overflow = false;
+};
+
+struct RenderOptions {
+  Syntax syntax = Syntax::RENESAS;
+  bool lowercase = false;  // implied by Syntax::GNU
+};
+
+// Longest text RenderText can write, e.g. "MOV.B #0xff,@(R0,GBR)" with a
+// 64-bit address in place of an operand
+constexpr size_t MAX_RENDERED_LENGTH = 40;
+
+/*
+ * Writes the assembly text of `insn` to `out` without a terminating NUL and
+ * returns its length, or 0 if it does not fit. Unless lowercased, the text
+ * is exactly the concatenated text of the instruction's tokens in the same
+ * syntax. Never allocates, and needs no BinaryView, so it suits exporting
+ * whole images.
+ */
+size_t RenderText(const DecodedInsn &insn, std::span<char> out,
+                  RenderOptions options = {});
+}  // namespace SuperH
+
+#endif  // SRC_RENDER_H_
@@ -0,0 +1,475 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_SPEC_H_
+#define SRC_SPEC_H_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "instructions.h"
+
+namespace SuperH {
+/*
+ * ISA membership masks for instruction specifications
+ */
+constexpr uint8_t IsaBit(const IsaType t) { return 1 << t; }
+
+constexpr uint8_t SH_2E_ONLY = IsaBit(SH_2E_ISA);
+constexpr uint8_t SH_2_UP = IsaBit(SH_2E_ISA) | IsaBit(SH_DSP_ISA);
+constexpr uint8_t ALL_ISAS = IsaBit(SH_1_ISA) | SH_2_UP;
+
+// Bits of a 16 character pattern such as "0011nnnnmmmm1100" that hold `c`.
+// The first character of the pattern is bit 15.
+constexpr uint16_t PatternBits(const std::string_view pattern, const char c) {
+  uint16_t bits = 0;
+  for (const auto p : pattern) {
+    bits = static_cast<uint16_t>(bits << 1 | (p == c));
+  }
+  return bits;
+}
+
+// An operand field of an opcode, e.g. the 'n' in "0011nnnnmmmm1100"
+struct OpcodeField {
+  uint16_t mask;
+  uint8_t shift;
+
+  [[nodiscard]] constexpr uint16_t Extract(const uint16_t opcode) const {
+    return (opcode & mask) >> shift;
+  }
+};
+
+constexpr OpcodeField FieldOf(const std::string_view pattern, const char c) {
+  const uint16_t mask = PatternBits(pattern, c);
+  uint8_t shift = 0;
+  while (mask != 0 && ((mask >> shift) & 1) == 0) {
+    shift++;
+  }
+  return OpcodeField{mask, shift};
+}
+
+/*
+ * Single source description of an instruction: its bit pattern, assembly
+ * syntax, the ISAs that implement it and the id of its class
+ */
+struct InstructionSpec {
+  std::string_view pattern;   // e.g. "0011nnnnmmmm1100"
+  std::string_view mnemonic;  // e.g. "ADD"
+  std::string_view operands;  // e.g. "Rm,Rn"
+  uint8_t isas;
+  InsnId id;
+
+  // Bits that are fixed by the pattern
+  [[nodiscard]] constexpr uint16_t Mask() const {
+    return PatternBits(pattern, '0') | PatternBits(pattern, '1');
+  }
+
+  // Values of the fixed bits
+  [[nodiscard]] constexpr uint16_t Match() const {
+    return PatternBits(pattern, '1');
+  }
+
+  [[nodiscard]] constexpr bool Matches(const uint16_t opcode) const {
+    return (opcode & Mask()) == Match();
+  }
+
+  [[nodiscard]] constexpr bool Supports(const IsaType t) const {
+    return (isas & IsaBit(t)) != 0;
+  }
+
+  [[nodiscard]] constexpr OpcodeField Field(const char c) const {
+    return FieldOf(pattern, c);
+  }
+};
+
+// Every instruction the decoder recognizes, ordered by opcode
+inline constexpr auto SPECS = std::to_array<InstructionSpec>({
+    {"0000000000001000", "CLRT", "", ALL_ISAS, InsnId::Clrt},
+    {"0000000000001001", "NOP", "", ALL_ISAS, InsnId::Nop},
+    {"0000000000001011", "RTS", "", ALL_ISAS, InsnId::Rts},
+    {"0000000000011000", "SETT", "", ALL_ISAS, InsnId::Sett},
+    {"0000000000011001", "DIV0U", "", ALL_ISAS, InsnId::Div0u},
+    {"0000000000011011", "SLEEP", "", ALL_ISAS, InsnId::Sleep},
+    {"0000000000101000", "CLRMAC", "", ALL_ISAS, InsnId::Clrmac},
+    {"0000000000101011", "RTE", "", ALL_ISAS, InsnId::Rte},
+    {"0000nnnn00000010", "STC", "SR,Rn", ALL_ISAS, InsnId::StcSrRn},
+    {"0000mmmm00000011", "BSRF", "Rm", SH_2_UP, InsnId::BsrfRm},
+    {"0000nnnn00001010", "STS", "MACH,Rn", ALL_ISAS, InsnId::StsMachRn},
+    {"0000nnnn00010010", "STC", "GBR,Rn", ALL_ISAS, InsnId::StcGbrRn},
+    {"0000nnnn00011010", "STS", "MACL,Rn", ALL_ISAS, InsnId::StsMaclRn},
+    {"0000nnnn00100010", "STC", "VBR,Rn", ALL_ISAS, InsnId::StcVbrRn},
+    {"0000mmmm00100011", "BRAF", "Rm", SH_2_UP, InsnId::BrafRm},
+    {"0000nnnn00101001", "MOVT", "Rn", ALL_ISAS, InsnId::MovtRn},
+    {"0000nnnn00101010", "STS", "PR,Rn", ALL_ISAS, InsnId::StsPrRn},
+    {"0000nnnn01011010", "STS", "FPUL,Rn", SH_2E_ONLY, InsnId::StsFpulRn},
+    {"0000nnnn01101010", "STS", "FPSCR,Rn", SH_2E_ONLY, InsnId::StsFpscrRn},
+    {"0000nnnnmmmm0100", "MOV.B", "Rm,@(R0,Rn)", ALL_ISAS,
+     InsnId::MovbRmIndrR0Rn},
+    {"0000nnnnmmmm0101", "MOV.W", "Rm,@(R0,Rn)", ALL_ISAS,
+     InsnId::MovwRmIndrR0Rn},
+    {"0000nnnnmmmm0110", "MOV.L", "Rm,@(R0,Rn)", ALL_ISAS,
+     InsnId::MovlRmIndrR0Rn},
+    {"0000nnnnmmmm0111", "MUL.L", "Rm,Rn", SH_2_UP, InsnId::MullRmRn},
+    {"0000nnnnmmmm1100", "MOV.B", "@(R0,Rm),Rn", ALL_ISAS,
+     InsnId::MovbIndrR0RmRn},
+    {"0000nnnnmmmm1101", "MOV.W", "@(R0,Rm),Rn", ALL_ISAS,
+     InsnId::MovwIndrR0RmRn},
+    {"0000nnnnmmmm1110", "MOV.L", "@(R0,Rm),Rn", ALL_ISAS,
+     InsnId::MovlIndrR0RmRn},
+    {"0000nnnnmmmm1111", "MAC.L", "@Rm+,@Rn+", SH_2_UP,
+     InsnId::MaclIndrRmPostincIndrRnPostinc},
+    {"0001nnnnmmmmdddd", "MOV.L", "Rm,@(disp,Rn)", ALL_ISAS,
+     InsnId::MovlRmIndrDispRn},
+    {"0010nnnnmmmm0000", "MOV.B", "Rm,@Rn", ALL_ISAS, InsnId::MovbRmIndrRn},
+    {"0010nnnnmmmm0001", "MOV.W", "Rm,@Rn", ALL_ISAS, InsnId::MovwRmIndrRn},
+    {"0010nnnnmmmm0010", "MOV.L", "Rm,@Rn", ALL_ISAS, InsnId::MovlRmIndrRn},
+    {"0010nnnnmmmm0100", "MOV.B", "Rm,@-Rn", ALL_ISAS,
+     InsnId::MovbRmIndrPredecRn},
+    {"0010nnnnmmmm0101", "MOV.W", "Rm,@-Rn", ALL_ISAS,
+     InsnId::MovwRmIndrPredecRn},
+    {"0010nnnnmmmm0110", "MOV.L", "Rm,@-Rn", ALL_ISAS,
+     InsnId::MovlRmIndrPredecRn},
+    {"0010nnnnmmmm0111", "DIV0S", "Rm,Rn", ALL_ISAS, InsnId::Div0sRmRn},
+    {"0010nnnnmmmm1000", "TST", "Rm,Rn", ALL_ISAS, InsnId::TstRmRn},
+    {"0010nnnnmmmm1001", "AND", "Rm,Rn", ALL_ISAS, InsnId::AndRmRn},
+    {"0010nnnnmmmm1010", "XOR", "Rm,Rn", ALL_ISAS, InsnId::XorRmRn},
+    {"0010nnnnmmmm1011", "OR", "Rm,Rn", ALL_ISAS, InsnId::OrRmRn},
+    {"0010nnnnmmmm1100", "CMP/STR", "Rm,Rn", ALL_ISAS, InsnId::CmpStrRmRn},
+    {"0010nnnnmmmm1101", "XTRCT", "Rm,Rn", ALL_ISAS, InsnId::XtrctRmRn},
+    {"0010nnnnmmmm1110", "MULU.W", "Rm,Rn", ALL_ISAS, InsnId::MuluwRmRn},
+    {"0010nnnnmmmm1111", "MULS.W", "Rm,Rn", ALL_ISAS, InsnId::MulswRmRn},
+    {"0011nnnnmmmm0000", "CMP/EQ", "Rm,Rn", ALL_ISAS, InsnId::CmpEqRmRn},
+    {"0011nnnnmmmm0010", "CMP/HS", "Rm,Rn", ALL_ISAS, InsnId::CmpHsRmRn},
+    {"0011nnnnmmmm0011", "CMP/GE", "Rm,Rn", ALL_ISAS, InsnId::CmpGeRmRn},
+    {"0011nnnnmmmm0100", "DIV1", "Rm,Rn", ALL_ISAS, InsnId::Div1RmRn},
+    {"0011nnnnmmmm0101", "DMULU.L", "Rm,Rn", SH_2_UP, InsnId::DmululRmRn},
+    {"0011nnnnmmmm0110", "CMP/HI", "Rm,Rn", ALL_ISAS, InsnId::CmpHiRmRn},
+    {"0011nnnnmmmm0111", "CMP/GT", "Rm,Rn", ALL_ISAS, InsnId::CmpGtRmRn},
+    {"0011nnnnmmmm1000", "SUB", "Rm,Rn", ALL_ISAS, InsnId::SubRmRn},
+    {"0011nnnnmmmm1010", "SUBC", "Rm,Rn", ALL_ISAS, InsnId::SubcRmRn},
+    {"0011nnnnmmmm1011", "SUBV", "Rm,Rn", ALL_ISAS, InsnId::SubvRmRn},
+    {"0011nnnnmmmm1100", "ADD", "Rm,Rn", ALL_ISAS, InsnId::AddRmRn},
+    {"0011nnnnmmmm1101", "DMULS.L", "Rm,Rn", SH_2_UP, InsnId::DmulslRmRn},
+    {"0011nnnnmmmm1110", "ADDC", "Rm,Rn", ALL_ISAS, InsnId::AddcRmRn},
+    {"0011nnnnmmmm1111", "ADDV", "Rm,Rn", ALL_ISAS, InsnId::AddvRmRn},
+    {"0100nnnn00000000", "SHLL", "Rn", ALL_ISAS, InsnId::ShllRn},
+    {"0100nnnn00000001", "SHLR", "Rn", ALL_ISAS, InsnId::ShlrRn},
+    {"0100nnnn00000010", "STS.L", "MACH,@-Rn", ALL_ISAS,
+     InsnId::StslMachIndrPredecRn},
+    {"0100nnnn00000011", "STC.L", "SR,@-Rn", ALL_ISAS,
+     InsnId::StclSrIndrPredecRn},
+    {"0100nnnn00000100", "ROTL", "Rn", ALL_ISAS, InsnId::RotlRn},
+    {"0100nnnn00000101", "ROTR", "Rn", ALL_ISAS, InsnId::RotrRn},
+    {"0100mmmm00000110", "LDS.L", "@Rm+,MACH", ALL_ISAS,
+     InsnId::LdslIndrRmPostincMach},
+    {"0100mmmm00000111", "LDC.L", "@Rm+,SR", ALL_ISAS,
+     InsnId::LdclIndrRmPostincSr},
+    {"0100nnnn00001000", "SHLL2", "Rn", ALL_ISAS, InsnId::Shll2Rn},
+    {"0100nnnn00001001", "SHLR2", "Rn", ALL_ISAS, InsnId::Shlr2Rn},
+    {"0100mmmm00001010", "LDS", "Rm,MACH", ALL_ISAS, InsnId::LdsRmMach},
+    {"0100mmmm00001011", "JSR", "@Rm", ALL_ISAS, InsnId::JsrIndrRm},
+    {"0100mmmm00001110", "LDC", "Rm,SR", ALL_ISAS, InsnId::LdcRmSr},
+    {"0100nnnn00010000", "DT", "Rn", SH_2_UP, InsnId::DtRn},
+    {"0100nnnn00010001", "CMP/PZ", "Rn", ALL_ISAS, InsnId::CmpPzRn},
+    {"0100nnnn00010010", "STS.L", "MACL,@-Rn", ALL_ISAS,
+     InsnId::StslMaclIndrPredecRn},
+    {"0100nnnn00010011", "STC.L", "GBR,@-Rn", ALL_ISAS,
+     InsnId::StclGbrIndrPredecRn},
+    {"0100nnnn00010101", "CMP/PL", "Rn", ALL_ISAS, InsnId::CmpPlRn},
+    {"0100mmmm00010110", "LDS.L", "@Rm+,MACL", ALL_ISAS,
+     InsnId::LdslIndrRmPostincMacl},
+    {"0100mmmm00010111", "LDC.L", "@Rm+,GBR", ALL_ISAS,
+     InsnId::LdclIndrRmPostincGbr},
+    {"0100nnnn00011000", "SHLL8", "Rn", ALL_ISAS, InsnId::Shll8Rn},
+    {"0100nnnn00011001", "SHLR8", "Rn", ALL_ISAS, InsnId::Shlr8Rn},
+    {"0100mmmm00011010", "LDS", "Rm,MACL", ALL_ISAS, InsnId::LdsRmMacl},
+    {"0100nnnn00011011", "TAS.B", "@Rn", ALL_ISAS, InsnId::TasbIndrRn},
+    {"0100mmmm00011110", "LDC", "Rm,GBR", ALL_ISAS, InsnId::LdcRmGbr},
+    {"0100nnnn00100000", "SHAL", "Rn", ALL_ISAS, InsnId::ShalRn},
+    {"0100nnnn00100001", "SHAR", "Rn", ALL_ISAS, InsnId::SharRn},
+    {"0100nnnn00100010", "STS.L", "PR,@-Rn", ALL_ISAS,
+     InsnId::StslPrIndrPredecRn},
+    {"0100nnnn00100011", "STC.L", "VBR,@-Rn", ALL_ISAS,
+     InsnId::StclVbrIndrPredecRn},
+    {"0100nnnn00100100", "ROTCL", "Rn", ALL_ISAS, InsnId::RotclRn},
+    {"0100nnnn00100101", "ROTCR", "Rn", ALL_ISAS, InsnId::RotcrRn},
+    {"0100mmmm00100110", "LDS.L", "@Rm+,PR", ALL_ISAS,
+     InsnId::LdslIndrRmPostincPr},
+    {"0100mmmm00100111", "LDC.L", "@Rm+,VBR", ALL_ISAS,
+     InsnId::LdclIndrRmPostincVbr},
+    {"0100nnnn00101000", "SHLL16", "Rn", ALL_ISAS, InsnId::Shll16Rn},
+    {"0100nnnn00101001", "SHLR16", "Rn", ALL_ISAS, InsnId::Shlr16Rn},
+    {"0100mmmm00101010", "LDS", "Rm,PR", ALL_ISAS, InsnId::LdsRmPr},
+    {"0100mmmm00101011", "JMP", "@Rm", ALL_ISAS, InsnId::JmpIndrRm},
+    {"0100mmmm00101110", "LDC", "Rm,VBR", ALL_ISAS, InsnId::LdcRmVbr},
+    {"0100nnnn01010010", "STS.L", "FPUL,@-Rn", SH_2E_ONLY,
+     InsnId::StslFpulIndrPredecRn},
+    {"0100mmmm01010110", "LDS.L", "@Rm+,FPUL", SH_2E_ONLY,
+     InsnId::LdslIndrRmPostincFpul},
+    {"0100mmmm01011010", "LDS", "Rm,FPUL", SH_2E_ONLY, InsnId::LdsRmFpul},
+    {"0100nnnn01100010", "STS.L", "FPSCR,@-Rn", SH_2E_ONLY,
+     InsnId::StslFpscrIndrPredecRn},
+    {"0100mmmm01100110", "LDS.L", "@Rm+,FPSCR", SH_2E_ONLY,
+     InsnId::LdslIndrRmPostincFpscr},
+    {"0100mmmm01101010", "LDS", "Rm,FPSCR", SH_2E_ONLY, InsnId::LdsRmFpscr},
+    {"0100nnnnmmmm1111", "MAC.W", "@Rm+,@Rn+", SH_2_UP,
+     InsnId::MacwIndrRmPostincIndrRnPostinc},
+    {"0101nnnnmmmmdddd", "MOV.L", "@(disp,Rm),Rn", ALL_ISAS,
+     InsnId::MovlIndrDispRmRn},
+    {"0110nnnnmmmm0000", "MOV.B", "@Rm,Rn", ALL_ISAS, InsnId::MovbIndrRmRn},
+    {"0110nnnnmmmm0001", "MOV.W", "@Rm,Rn", ALL_ISAS, InsnId::MovwIndrRmRn},
+    {"0110nnnnmmmm0010", "MOV.L", "@Rm,Rn", ALL_ISAS, InsnId::MovlIndrRmRn},
+    {"0110nnnnmmmm0011", "MOV", "Rm,Rn", ALL_ISAS, InsnId::MovRmRn},
+    {"0110nnnnmmmm0100", "MOV.B", "@Rm+,Rn", ALL_ISAS,
+     InsnId::MovbIndrRmPostincRn},
+    {"0110nnnnmmmm0101", "MOV.W", "@Rm+,Rn", ALL_ISAS,
+     InsnId::MovwIndrRmPostincRn},
+    {"0110nnnnmmmm0110", "MOV.L", "@Rm+,Rn", ALL_ISAS,
+     InsnId::MovlIndrRmPostincRn},
+    {"0110nnnnmmmm0111", "NOT", "Rm,Rn", ALL_ISAS, InsnId::NotRmRn},
+    {"0110nnnnmmmm1000", "SWAP.B", "Rm,Rn", ALL_ISAS, InsnId::SwapbRmRn},
+    {"0110nnnnmmmm1001", "SWAP.W", "Rm,Rn", ALL_ISAS, InsnId::SwapwRmRn},
+    {"0110nnnnmmmm1010", "NEGC", "Rm,Rn", ALL_ISAS, InsnId::NegcRmRn},
+    {"0110nnnnmmmm1011", "NEG", "Rm,Rn", ALL_ISAS, InsnId::NegRmRn},
+    {"0110nnnnmmmm1100", "EXTU.B", "Rm,Rn", ALL_ISAS, InsnId::ExtubRmRn},
+    {"0110nnnnmmmm1101", "EXTU.W", "Rm,Rn", ALL_ISAS, InsnId::ExtuwRmRn},
+    {"0110nnnnmmmm1110", "EXTS.B", "Rm,Rn", ALL_ISAS, InsnId::ExtsbRmRn},
+    {"0110nnnnmmmm1111", "EXTS.W", "Rm,Rn", ALL_ISAS, InsnId::ExtswRmRn},
+    {"0111nnnniiiiiiii", "ADD", "#imm,Rn", ALL_ISAS, InsnId::AddImmRn},
+    {"10000000nnnndddd", "MOV.B", "R0,@(disp,Rn)", ALL_ISAS,
+     InsnId::MovbR0IndrDispRn},
+    {"10000001nnnndddd", "MOV.W", "R0,@(disp,Rn)", ALL_ISAS,
+     InsnId::MovwR0IndrDispRn},
+    {"10000100mmmmdddd", "MOV.B", "@(disp,Rm),R0", ALL_ISAS,
+     InsnId::MovbIndrDispRmR0},
+    {"10000101mmmmdddd", "MOV.W", "@(disp,Rm),R0", ALL_ISAS,
+     InsnId::MovwIndrDispRmR0},
+    {"10001000iiiiiiii", "CMP/EQ", "#imm,R0", ALL_ISAS, InsnId::CmpEqImmR0},
+    {"10001001dddddddd", "BT", "label", ALL_ISAS, InsnId::BtDisp},
+    {"10001011dddddddd", "BF", "label", ALL_ISAS, InsnId::BfDisp},
+    {"10001101dddddddd", "BT/S", "label", SH_2_UP, InsnId::BtsDisp},
+    {"10001111dddddddd", "BF/S", "label", SH_2_UP, InsnId::BfsDisp},
+    {"1001nnnndddddddd", "MOV.W", "@(disp,PC),Rn", ALL_ISAS,
+     InsnId::MovwIndrDispPcRn},
+    {"1010dddddddddddd", "BRA", "label", ALL_ISAS, InsnId::BraDisp},
+    {"1011dddddddddddd", "BSR", "label", ALL_ISAS, InsnId::BsrDisp},
+    {"11000000dddddddd", "MOV.B", "R0,@(disp,GBR)", ALL_ISAS,
+     InsnId::MovbR0IndrDispGbr},
+    {"11000001dddddddd", "MOV.W", "R0,@(disp,GBR)", ALL_ISAS,
+     InsnId::MovwR0IndrDispGbr},
+    {"11000010dddddddd", "MOV.L", "R0,@(disp,GBR)", ALL_ISAS,
+     InsnId::MovlR0IndrDispGbr},
+    {"11000011iiiiiiii", "TRAPA", "#imm", ALL_ISAS, InsnId::TrapaImm},
+    {"11000100dddddddd", "MOV.B", "@(disp,GBR),R0", ALL_ISAS,
+     InsnId::MovbIndrDispGbrR0},
+    {"11000101dddddddd", "MOV.W", "@(disp,GBR),R0", ALL_ISAS,
+     InsnId::MovwIndrDispGbrR0},
+    {"11000110dddddddd", "MOV.L", "@(disp,GBR),R0", ALL_ISAS,
+     InsnId::MovlIndrDispGbrR0},
+    {"11000111dddddddd", "MOVA", "@(disp,PC),R0", ALL_ISAS,
+     InsnId::MovaIndrDispPcR0},
+    {"11001000iiiiiiii", "TST", "#imm,R0", ALL_ISAS, InsnId::TstImmR0},
+    {"11001001iiiiiiii", "AND", "#imm,R0", ALL_ISAS, InsnId::AndImmR0},
+    {"11001010iiiiiiii", "XOR", "#imm,R0", ALL_ISAS, InsnId::XorImmR0},
+    {"11001011iiiiiiii", "OR", "#imm,R0", ALL_ISAS, InsnId::OrImmR0},
+    {"11001100iiiiiiii", "TST.B", "#imm,@(R0,GBR)", ALL_ISAS,
+     InsnId::TstbImmIndrR0Gbr},
+    {"11001101iiiiiiii", "AND.B", "#imm,@(R0,GBR)", ALL_ISAS,
+     InsnId::AndbImmIndrR0Gbr},
+    {"11001110iiiiiiii", "XOR.B", "#imm,@(R0,GBR)", ALL_ISAS,
+     InsnId::XorbImmIndrR0Gbr},
+    {"11001111iiiiiiii", "OR.B", "#imm,@(R0,GBR)", ALL_ISAS,
+     InsnId::OrbImmIndrR0Gbr},
+    {"1101nnnndddddddd", "MOV.L", "@(disp,PC),Rn", ALL_ISAS,
+     InsnId::MovlIndrDispPcRn},
+    {"1110nnnniiiiiiii", "MOV", "#imm,Rn", ALL_ISAS, InsnId::MovImmRn},
+    {"1111nnnn00001101", "FSTS", "FPUL,FRn", SH_2E_ONLY, InsnId::FstsFpulFrn},
+    {"1111mmmm00011101", "FLDS", "FRm,FPUL", SH_2E_ONLY, InsnId::FldsFrmFpul},
+    {"1111nnnn00101101", "FLOAT", "FPUL,FRn", SH_2E_ONLY, InsnId::FloatFpulFrn},
+    {"1111mmmm00111101", "FTRC", "FRm,FPUL", SH_2E_ONLY, InsnId::FtrcFrmFpul},
+    {"1111nnnn01001101", "FNEG", "FRn", SH_2E_ONLY, InsnId::FnegFrn},
+    {"1111nnnn01011101", "FABS", "FRn", SH_2E_ONLY, InsnId::FabsFrn},
+    {"1111nnnn10001101", "FLDI0", "FRn", SH_2E_ONLY, InsnId::Fldi0Frn},
+    {"1111nnnn10011101", "FLDI1", "FRn", SH_2E_ONLY, InsnId::Fldi1Frn},
+    {"1111nnnnmmmm0000", "FADD", "FRm,FRn", SH_2E_ONLY, InsnId::FaddFrmFrn},
+    {"1111nnnnmmmm0001", "FSUB", "FRm,FRn", SH_2E_ONLY, InsnId::FsubFrmFrn},
+    {"1111nnnnmmmm0010", "FMUL", "FRm,FRn", SH_2E_ONLY, InsnId::FmulFrmFrn},
+    {"1111nnnnmmmm0011", "FDIV", "FRm,FRn", SH_2E_ONLY, InsnId::FdivFrmFrn},
+    {"1111nnnnmmmm0100", "FCMP/EQ", "FRm,FRn", SH_2E_ONLY,
+     InsnId::FcmpEqFrmFrn},
+    {"1111nnnnmmmm0101", "FCMP/GT", "FRm,FRn", SH_2E_ONLY,
+     InsnId::FcmpGtFrmFrn},
+    {"1111nnnnmmmm0110", "FMOV.S", "@(R0,Rm),FRn", SH_2E_ONLY,
+     InsnId::FmovsIndrR0RmFrn},
+    {"1111nnnnmmmm0111", "FMOV.S", "FRm,@(R0,Rn)", SH_2E_ONLY,
+     InsnId::FmovsFrmIndrR0Rn},
+    {"1111nnnnmmmm1000", "FMOV.S", "@Rm,FRn", SH_2E_ONLY,
+     InsnId::FmovsIndrRmFrn},
+    {"1111nnnnmmmm1001", "FMOV.S", "@Rm+,FRn", SH_2E_ONLY,
+     InsnId::FmovsIndrRmPostincFrn},
+    {"1111nnnnmmmm1010", "FMOV.S", "FRm,@Rn", SH_2E_ONLY,
+     InsnId::FmovsFrmIndrRn},
+    {"1111nnnnmmmm1011", "FMOV.S", "FRm,@-Rn", SH_2E_ONLY,
+     InsnId::FmovsFrmIndrPredecRn},
+    {"1111nnnnmmmm1100", "FMOV", "FRm,FRn", SH_2E_ONLY, InsnId::FmovFrmFrn},
+    {"1111nnnnmmmm1110", "FMAC", "FR0,FRm,FRn", SH_2E_ONLY,
+     InsnId::FmacFr0FrmFrn},
+});
+
+// Mnemonic of an instruction, e.g. "MOV.L"
+constexpr std::string_view Mnemonic(const InsnId id) {
+  return SPECS[static_cast<size_t>(id)].mnemonic;
+}
+
+// Number of text tokens an instruction with `operands` renders to: its
+// mnemonic, then a space and one token per symbol or name of its operands,
+// e.g. 10 for "MOV.L @(disp,Rm),Rn". A PC-relative "@(disp,PC)" renders as a
+// prefix and the resolved address.
+constexpr size_t CountTokens(const std::string_view operands) {
+  constexpr std::string_view pc_relative = "@(disp,PC)";
+  const auto is_name = [](const char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+           (c >= '0' && c <= '9');
+  };
+
+  if (operands.empty()) {
+    return 1;
+  }
+  size_t count = 2;
+  for (size_t i = 0; i < operands.size(); i++) {
+    if (operands.substr(i).starts_with(pc_relative)) {
+      count += 2;
+      i += pc_relative.size() - 1;
+    } else if (!is_name(operands[i]) || i == 0 ||
+               !is_name(operands[i - 1])) {
+      count++;
+    }
+  }
+  return count;
+}
+
+inline constexpr auto TOKEN_COUNTS = [] {
+  std::array<uint8_t, SPECS.size()> counts{};
+  for (size_t i = 0; i < SPECS.size(); i++) {
+    counts[i] = static_cast<uint8_t>(CountTokens(SPECS[i].operands));
+  }
+  return counts;
+}();
+
+static_assert(CountTokens("@(disp,Rm),Rn") == 10);
+static_assert(CountTokens("@(disp,PC),R0") == 6);
+
+// Tokens the text of an instruction is rendered to
+constexpr size_t TokenCount(const InsnId id) {
+  return TOKEN_COUNTS[static_cast<size_t>(id)];
+}
+
+// Returns the specification that matches `opcode` on ISA `t`, or nullptr
+constexpr const InstructionSpec *FindSpec(const IsaType t,
+                                          const uint16_t opcode) {
+  for (const auto &spec : SPECS) {
+    if (spec.Supports(t) && spec.Matches(opcode)) {
+      return &spec;
+    }
+  }
+  return nullptr;
+}
+
+// Checks that every pattern is well formed and that no two specifications
+// implemented by the same ISA can match the same opcode
+constexpr bool ValidateSpecs() {
+  for (size_t i = 0; i < SPECS.size(); i++) {
+    if (SPECS[i].id != static_cast<InsnId>(i)) {
+      return false;
+    }
+  }
+  for (const auto &spec : SPECS) {
+    if (spec.pattern.size() != 16 || spec.mnemonic.empty()) {
+      return false;
+    }
+    for (const auto c : spec.pattern) {
+      if (std::string_view("01nmdi").find(c) == std::string_view::npos) {
+        return false;
+      }
+    }
+  }
+  for (size_t a = 0; a < SPECS.size(); a++) {
+    for (size_t b = a + 1; b < SPECS.size(); b++) {
+      const auto shared = SPECS[a].Mask() & SPECS[b].Mask();
+      if ((SPECS[a].isas & SPECS[b].isas) != 0 &&
+          ((SPECS[a].Match() ^ SPECS[b].Match()) & shared) == 0) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static_assert(ValidateSpecs(), "instruction specifications are ambiguous");
+static_assert(SPECS.size() == INSN_COUNT,
+              "every InsnId needs exactly one specification");
+
+/*
+ * Where DecodeInstruction finds the operands of an instruction, and how it
+ * turns the displacement or immediate field into a byte offset or value
+ */
+struct OperandLayout {
+  OpcodeField n, m, raw;
+  uint16_t sign_bit;  // top bit of a sign-extended field, or 0
+  uint8_t scale;      // bytes per displacement unit
+  bool pc_relative;
+  uint32_t pc_mask;  // applied to the instruction address before adding
+};
+
+constexpr OperandLayout LayoutOf(const InstructionSpec &spec) {
+  OperandLayout layout{.n = spec.Field('n'),
+                       .m = spec.Field('m'),
+                       .raw = spec.Field('d'),
+                       .sign_bit = 0,
+                       .scale = 1,
+                       .pc_relative = false,
+                       .pc_mask = 0xFFFFFFFF};
+  const auto has = [&spec](const std::string_view s) {
+    return spec.operands.find(s) != std::string_view::npos;
+  };
+
+  if (has("#imm")) {
+    // Only the arithmetic immediates are sign-extended
+    layout.raw = spec.Field('i');
+    if (spec.mnemonic == "ADD" || spec.mnemonic == "MOV" ||
+        spec.mnemonic == "CMP/EQ") {
+      layout.sign_bit = (layout.raw.mask >> layout.raw.shift) / 2 + 1;
+    }
+  } else if (has("label")) {
+    // Branch displacements count signed instructions from PC + 4
+    layout.sign_bit = (layout.raw.mask >> layout.raw.shift) / 2 + 1;
+    layout.scale = 2;
+    layout.pc_relative = true;
+  } else if (has("disp")) {
+    // Displacements count operands of the access size
+    if (spec.mnemonic.ends_with(".W")) {
+      layout.scale = 2;
+    } else if (spec.mnemonic.ends_with(".L") || spec.mnemonic == "MOVA") {
+      layout.scale = 4;
+    }
+    if (has("PC")) {
+      // Longword accesses are relative to PC with the low two bits cleared
+      layout.pc_relative = true;
+      layout.pc_mask = layout.scale == 4 ? 0xFFFFFFFC : 0xFFFFFFFF;
+    }
+  }
+  return layout;
+}
+
+// Operand layouts, indexed like SPECS
+inline constexpr auto LAYOUTS = [] {
+  std::array<OperandLayout, SPECS.size()> layouts{};
+  for (size_t i = 0; i < SPECS.size(); i++) {
+    layouts[i] = LayoutOf(SPECS[i]);
+  }
+  return layouts;
+}();
+}  // namespace SuperH
+
+#endif  // SRC_SPEC_H_
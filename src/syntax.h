@@ -0,0 +1,120 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_SYNTAX_H_
+#define SRC_SYNTAX_H_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+#include "registers.h"
+#include "spec.h"
+
+namespace SuperH {
+enum class Syntax : uint8_t {
+  // The Renesas manuals, e.g. "MOV.L @(0x2,R4),R1"
+  RENESAS,
+  // GNU as and objdump, with byte displacements and decimal immediates, e.g.
+  // "mov.l\t@(8,r4),r1"
+  GNU,
+};
+
+/*
+ * Syntax policies. The text and render code takes one as a template
+ * parameter, so that each syntax is compiled into its own renderer and
+ * picking one costs a single branch per instruction rather than one per
+ * token.
+ */
+struct RenesasSyntax {
+  static constexpr Syntax ID = Syntax::RENESAS;
+  static constexpr bool LOWERCASE = false;
+  // Between the mnemonic and the first operand
+  static constexpr std::string_view SEPARATOR = " ";
+  // Displacements in bytes and immediates as their values, in decimal,
+  // instead of their encoded fields in hex
+  static constexpr bool DECIMAL = false;
+  // "@" before the address a PC-relative load reads and "#" before MOVA's
+  static constexpr bool ADDRESS_SIGILS = true;
+};
+
+struct GnuSyntax {
+  static constexpr Syntax ID = Syntax::GNU;
+  static constexpr bool LOWERCASE = true;
+  static constexpr std::string_view SEPARATOR = "\t";
+  static constexpr bool DECIMAL = true;
+  static constexpr bool ADDRESS_SIGILS = false;
+};
+
+// Calls `f` with the policy of `syntax`
+template <class F>
+decltype(auto) WithSyntax(const Syntax syntax, F &&f) {
+  if (syntax == Syntax::GNU) {
+    return f(GnuSyntax{});
+  }
+  return f(RenesasSyntax{});
+}
+
+// Lowercase copies of constant names, built at compile time
+template <size_t N>
+class LowercaseNames {
+ public:
+  static constexpr size_t MAX_LENGTH = 12;
+
+  explicit constexpr LowercaseNames(
+      const std::array<std::string_view, N> &names) {
+    for (size_t i = 0; i < N; i++) {
+      // A longer name fails constant evaluation here
+      text[i].at(names[i].size());
+      for (size_t c = 0; c < names[i].size(); c++) {
+        const char ch = names[i][c];
+        text[i][c] = ch >= 'A' && ch <= 'Z' ? ch - 'A' + 'a' : ch;
+      }
+      lengths[i] = static_cast<uint8_t>(names[i].size());
+    }
+  }
+
+  constexpr std::string_view operator[](const size_t i) const {
+    return {text[i].data(), lengths[i]};
+  }
+
+ private:
+  std::array<std::array<char, MAX_LENGTH>, N> text{};
+  std::array<uint8_t, N> lengths{};
+};
+
+inline constexpr LowercaseNames<SPECS.size()> LOWERCASE_MNEMONICS([] {
+  std::array<std::string_view, SPECS.size()> names{};
+  for (size_t i = 0; i < SPECS.size(); i++) {
+    names[i] = SPECS[i].mnemonic;
+  }
+  return names;
+}());
+
+inline constexpr LowercaseNames<Registers::NAMES.size()> LOWERCASE_REGISTERS(
+    Registers::NAMES);
+
+static_assert(LOWERCASE_REGISTERS[Registers::FPSCR] == "fpscr");
+
+template <class SYNTAX>
+constexpr std::string_view MnemonicName(const InsnId id) {
+  if constexpr (SYNTAX::LOWERCASE) {
+    return LOWERCASE_MNEMONICS[static_cast<size_t>(id)];
+  } else {
+    return Mnemonic(id);
+  }
+}
+
+// Name of a register, or an empty string for an unknown id
+template <class SYNTAX>
+constexpr std::string_view RegisterName(const uint32_t rid) {
+  if constexpr (SYNTAX::LOWERCASE) {
+    return rid < Registers::NAMES.size() ? LOWERCASE_REGISTERS[rid]
+                                         : std::string_view{};
+  } else {
+    return Registers::GetName(rid);
+  }
+}
+}  // namespace SuperH
+
+#endif  // SRC_SYNTAX_H_
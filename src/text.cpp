@@ -3,464 +3,537 @@
 
 #include <binaryninjaapi.h>
 
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "hex.h"
 #include "instructions.h"
-#include "opcodes.h"
 #include "registers.h"
+#include "render.h"
+#include "spec.h"
+#include "syntax.h"
 
-#define ITEXT(instr) result.emplace_back(InstructionToken, instr);
-#define SPACETEXT result.emplace_back(TextToken, " ");
-#define OPSEPTEXT result.emplace_back(OperandSeparatorToken, ",");
+#define ITEXT Emit(result, InstructionToken, MnemonicName<SYNTAX>(insn.id));
+#define SPACETEXT Emit(result, TextToken, SYNTAX::SEPARATOR);
+#define OPSEPTEXT Emit(result, OperandSeparatorToken, ",");
 #define REGTOFPREG(reg) reg += Registers::FR0;
 
 namespace BN = BinaryNinja;
 
 namespace SuperH {
+using Tokens = std::vector<BN::InstructionTextToken>;
+
+/*
+ * Token output. The formatters below write either Binary Ninja tokens or,
+ * through a TextWriter, just their text, so that both are formatted here
+ * once and the plain text never allocates.
+ */
+static void Emit(Tokens &result, const BNInstructionTextTokenType type,
+                 const std::string_view text, const uint64_t value = 0) {
+  result.emplace_back(type, std::string(text), value);
+}
+
+static void Emit(TextWriter &result, BNInstructionTextTokenType,
+                 const std::string_view text, uint64_t = 0) {
+  result.Put(text);
+}
+
+// "0" for zero, otherwise e.g. "0x3c"
+static void EmitHex(Tokens &result, const BNInstructionTextTokenType type,
+                    const uint64_t value) {
+  result.emplace_back(type, FormatHex(value), value);
+}
+
+static void EmitHex(TextWriter &result, BNInstructionTextTokenType,
+                    const uint64_t value) {
+  result.PutHex(value, false);
+}
+
+static void EmitDecimal(Tokens &result, const BNInstructionTextTokenType type,
+                        const int64_t value) {
+  result.emplace_back(type, std::to_string(value), value);
+}
+
+static void EmitDecimal(TextWriter &result, BNInstructionTextTokenType,
+                        const int64_t value) {
+  result.PutNumber(value, 10);
+}
+
+// A resolved address, with a 0x prefix even when zero
+static void EmitAddress(Tokens &result, const uint64_t target) {
+  result.emplace_back(PossibleAddressToken, FormatAddress(target), target);
+}
+
+static void EmitAddress(TextWriter &result, const uint64_t target) {
+  result.PutHex(target, true);
+}
+
 /*
  * Text format methods
  */
 
-void GenerateRegisterTokens(std::vector<BN::InstructionTextToken> &result,
-                            RegTextInfo rti) {
+template <class SYNTAX, class OUT>
+void GenerateRegisterTokens(OUT &result, RegTextInfo rti) {
   // The @ symbol for indirect addressing always appears first
   if (rti.indirect) {
-    result.emplace_back(BeginMemoryOperandToken, "@");
+    Emit(result, BeginMemoryOperandToken, "@");
   }
   // If we are using a displacement, the format is (disp,Reg)
   if (rti.use_disp) {
-    result.emplace_back(TextToken, "(");
-
-    char disp[19];
-    std::snprintf(disp, std::size(disp), "%#lx", rti.disp);
-    result.emplace_back(IntegerToken, disp, rti.disp);
-    result.emplace_back(TextToken, ",");
+    Emit(result, TextToken, "(");
+
+    if constexpr (SYNTAX::DECIMAL) {
+      EmitDecimal(result, IntegerToken, rti.disp);
+    } else {
+      EmitHex(result, IntegerToken, rti.disp);
+    }
+    Emit(result, TextToken, ",");
   }
   // Some instructions are indexed from R0, formatted similar to the
   // displacement
   if (rti.indexed) {
-    result.emplace_back(TextToken, "(");
-    result.emplace_back(RegisterToken, Registers::to_string(Registers::R0));
-    result.emplace_back(TextToken, ",");
+    Emit(result, TextToken, "(");
+    Emit(result, RegisterToken, RegisterName<SYNTAX>(Registers::R0));
+    Emit(result, TextToken, ",");
   }
   // Add the pre-decrement operator
   if (rti.predec) {
-    result.emplace_back(TextToken, "-");
+    Emit(result, TextToken, "-");
   }
 
   // Add the actual register operand
-  result.emplace_back(RegisterToken, Registers::to_string(rti.regnum));
+  Emit(result, RegisterToken, RegisterName<SYNTAX>(rti.regnum));
 
   // Add the post-increment operator
   if (rti.postinc) {
-    result.emplace_back(TextToken, "+");
+    Emit(result, TextToken, "+");
   }
   // Close displacement
   if (rti.use_disp) {
-    result.emplace_back(TextToken, ")");
+    Emit(result, TextToken, ")");
   }
   // Close index
   if (rti.indexed) {
-    result.emplace_back(TextToken, ")");
+    Emit(result, TextToken, ")");
   }
 }
 
-// Produce text, in unsigned hex format, for immediate operand
-void generateImmText(std::vector<BN::InstructionTextToken> &result,
-                     const uint8_t imm8) {
-  char immText[5];
+// Produce text for the immediate operand: the encoded field in unsigned hex,
+// or its value in decimal
+template <class SYNTAX, class OUT>
+void generateImmText(OUT &result, const DecodedInsn &insn) {
+  Emit(result, TextToken, "#");
+  if constexpr (SYNTAX::DECIMAL) {
+    EmitDecimal(result, IntegerToken, insn.imm);
+  } else {
+    const auto imm8 = static_cast<uint8_t>(insn.raw);
+    Emit(result, IntegerToken, FormatImmediate(imm8), imm8);
+  }
+}
 
-  result.emplace_back(TextToken, "#");
-  std::snprintf(immText, sizeof(immText), "%#hhx", imm8);
-  result.emplace_back(IntegerToken, immText, imm8);
+// Displacement as shown: the encoded field, or the offset in bytes
+template <class SYNTAX>
+int64_t Displacement(const DecodedInsn &insn) {
+  return SYNTAX::DECIMAL ? insn.imm : insn.raw;
 }
 
 // Opcode text only; e.g. NOP
-void Text0Format(std::vector<BN::InstructionTextToken> &result,
-                 const std::string &instr) {
-  ITEXT(instr)
+template <class SYNTAX, class OUT>
+void Text0Format(const DecodedInsn &insn, OUT &result) {
+  ITEXT
 }
 
 // dst: direct register; e.g. MOVT Rn
-void TextNFormatDstRn(const uint16_t opcode,
-                      std::vector<BN::InstructionTextToken> &result,
-                      const std::string &instr, const bool fp) {
-  auto n = GetNFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextNFormatDstRn(const DecodedInsn &insn, OUT &result, const bool fp) {
+  auto n = insn.n;
   if (fp) {
     REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
 // dst: indirect register; e.g. TAS.B @Rn
-void TextNFormatDstIndrRn(const uint16_t opcode,
-                          std::vector<BN::InstructionTextToken> &result,
-                          const std::string &instr) {
-  const auto n = GetNFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextNFormatDstIndrRn(const DecodedInsn &insn, OUT &result) {
+  const auto n = insn.n;
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n, .indirect = true});
+  GenerateRegisterTokens<SYNTAX>(result,
+                                 RegTextInfo{.regnum = n, .indirect = true});
 }
 
 // src: control/sys reg, dst: direct reg; e.g. STS MACH, Rn
-void TextNFormatSrcCtrlSysRegDstRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const uint32_t ctrl_sys_reg, const bool fp) {
-  auto n = GetNFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextNFormatSrcCtrlSysRegDstRn(const DecodedInsn &insn, OUT &result,
+                                   const uint32_t ctrl_sys_reg, const bool fp) {
+  auto n = insn.n;
   if (fp) {
     REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = ctrl_sys_reg});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = ctrl_sys_reg});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
-void TextNFormatSrcRmDstCtrlSysReg(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const uint32_t ctrl_sys_reg, const bool fp) {
-  auto n = GetNFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextNFormatSrcRmDstCtrlSysReg(const DecodedInsn &insn, OUT &result,
+                                   const uint32_t ctrl_sys_reg, const bool fp) {
+  auto m = insn.m;
   if (fp) {
-    REGTOFPREG(n)
+    REGTOFPREG(m)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = m});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = ctrl_sys_reg});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = ctrl_sys_reg});
 }
 
-void TextNFormatSrcIndrPostincRmDstCtrlSysReg(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const uint32_t ctrl_sys_reg, const bool fp) {
-  auto n = GetNFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextNFormatSrcIndrPostincRmDstCtrlSysReg(const DecodedInsn &insn,
+                                              OUT &result,
+                                              const uint32_t ctrl_sys_reg,
+                                              const bool fp) {
+  auto m = insn.m;
   if (fp) {
-    REGTOFPREG(n)
+    REGTOFPREG(m)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(
-      result, RegTextInfo{.regnum = n, .indirect = true, .postinc = true});
+  GenerateRegisterTokens<SYNTAX>(
+      result, RegTextInfo{.regnum = m, .indirect = true, .postinc = true});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = ctrl_sys_reg});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = ctrl_sys_reg});
 }
 
 // src: control/sys reg, dst: indirect, pre-decremented reg; e.g. STC.L SR,@-Rn
-void TextNFormatSrcCtrlSysRegDstIndrPredecRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const uint32_t ctrl_sys_reg, const bool fp) {
-  auto n = GetNFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextNFormatSrcCtrlSysRegDstIndrPredecRn(const DecodedInsn &insn,
+                                             OUT &result,
+                                             const uint32_t ctrl_sys_reg,
+                                             const bool fp) {
+  auto n = insn.n;
   if (fp) {
     REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = ctrl_sys_reg});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = ctrl_sys_reg});
   OPSEPTEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result, RegTextInfo{.regnum = n, .indirect = true, .predec = true});
 }
 
 // src: direct reg, dst: control/sys reg; e.g. LDC Rm,SR
-void TextMFormatSrcRmDstCtrlSysReg(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const uint32_t ctrl_sys_reg) {
-  const auto m = GetMFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextMFormatSrcRmDstCtrlSysReg(const DecodedInsn &insn, OUT &result,
+                                   const uint32_t ctrl_sys_reg) {
+  const auto m = insn.m;
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = m});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = ctrl_sys_reg});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = ctrl_sys_reg});
 }
 
 // src: indirect, post-incremented reg, dst: control/sys reg; e.g. LDC.L @Rm+,SR
-void TextMFormatSrcIndrPostincRmDstCtrlSysReg(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const uint32_t ctrl_sys_reg) {
-  const auto m = GetMFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextMFormatSrcIndrPostincRmDstCtrlSysReg(const DecodedInsn &insn,
+                                              OUT &result,
+                                              const uint32_t ctrl_sys_reg) {
+  const auto m = insn.m;
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result, RegTextInfo{.regnum = m, .indirect = true, .postinc = true});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = ctrl_sys_reg});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = ctrl_sys_reg});
 }
 
 // src: indirect reg; e.g. JMP @Rm
-void TextMFormatSrcIndrRm(const uint16_t opcode,
-                          std::vector<BN::InstructionTextToken> &result,
-                          const std::string &instr) {
-  const auto m = GetMFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextMFormatSrcIndrRm(const DecodedInsn &insn, OUT &result) {
+  const auto m = insn.m;
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m, .indirect = true});
+  GenerateRegisterTokens<SYNTAX>(result,
+                                 RegTextInfo{.regnum = m, .indirect = true});
 }
 
 // src: PC relative reg; e.g. BRAF Rm
-void TextMFormatSrcPCrelRm(const uint16_t opcode,
-                           std::vector<BN::InstructionTextToken> &result,
-                           const std::string &instr) {
-  const auto m = GetMFormatOpcodeField(opcode);
+template <class SYNTAX, class OUT>
+void TextMFormatSrcPCrelRm(const DecodedInsn &insn, OUT &result) {
+  const auto m = insn.m;
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = m});
 }
 
 // src/dst: direct registers; e.g. ADD Rm, Rn
-void TextNMFormatSrcRmDstRn(const uint16_t opcode,
-                            std::vector<BN::InstructionTextToken> &result,
-                            const std::string &instr, const bool fp) {
-  auto [n, m] = GetNMFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcRmDstRn(const DecodedInsn &insn, OUT &result,
+                            const bool fp) {
+  auto n = insn.n;
+  auto m = insn.m;
   if (fp) {
     REGTOFPREG(m)
     REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = m});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
 // FPU instruction format FR0, FRm, FRn; e.g. FMAC FR0,FRm,FRn
-void TextNMFormatFR0FRmFRn(const uint16_t opcode,
-                           std::vector<BN::InstructionTextToken> &result,
-                           const std::string &instr) {
-  auto [n, m] = GetNMFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMFormatFR0FRmFRn(const DecodedInsn &insn, OUT &result) {
+  auto n = insn.n;
+  auto m = insn.m;
   REGTOFPREG(m)
   REGTOFPREG(n)
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = Registers::FR0});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = Registers::FR0});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = m});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
 // src: direct reg, dst: indirect reg; e.g. MOV.L Rm, @Rn
-void TextNMFormatSrcRmDstIndrRn(const uint16_t opcode,
-                                std::vector<BN::InstructionTextToken> &result,
-                                const std::string &instr, const bool fp) {
-  auto [n, m] = GetNMFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcRmDstIndrRn(const DecodedInsn &insn, OUT &result,
+                                const bool fp) {
+  auto n = insn.n;
+  auto m = insn.m;
   if (fp) {
     REGTOFPREG(m)
-    REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = m});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n, .indirect = true});
+  GenerateRegisterTokens<SYNTAX>(result,
+                                 RegTextInfo{.regnum = n, .indirect = true});
 }
 
 // src: indirect reg, dst: direct reg; e.g. MOV.L @Rm, Rn
-void TextNMFormatSrcIndrRmDstRn(const uint16_t opcode,
-                                std::vector<BN::InstructionTextToken> &result,
-                                const std::string &instr, const bool fp) {
-  auto [n, m] = GetNMFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcIndrRmDstRn(const DecodedInsn &insn, OUT &result,
+                                const bool fp) {
+  auto n = insn.n;
+  auto m = insn.m;
   if (fp) {
-    REGTOFPREG(m)
     REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m, .indirect = true});
+  GenerateRegisterTokens<SYNTAX>(result,
+                                 RegTextInfo{.regnum = m, .indirect = true});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
 // src: n & m, indirect and post-incremented, dst: MACH, MACL; e.g. MAC.W
 // @Rm+,@Rn+
-void TextNMFormatSrcIndrPostincRmRnDstMAC(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr) {
-  auto [n, m] = GetNMFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcIndrPostincRmRnDstMAC(const DecodedInsn &insn,
+                                          OUT &result) {
+  auto n = insn.n;
+  auto m = insn.m;
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result, RegTextInfo{.regnum = m, .indirect = true, .postinc = true});
   OPSEPTEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result, RegTextInfo{.regnum = n, .indirect = true, .postinc = true});
 }
 
 // src: indirect, post-incremented reg, dst: direct reg; e.g. MOV.L @Rm+,Rn
-void TextNMFormatSrcIndrPostincRmDstRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const bool fp) {
-  auto [n, m] = GetNMFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcIndrPostincRmDstRn(const DecodedInsn &insn, OUT &result,
+                                       const bool fp) {
+  auto n = insn.n;
+  auto m = insn.m;
   if (fp) {
-    REGTOFPREG(m)
     REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result, RegTextInfo{.regnum = m, .indirect = true, .postinc = true});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
 // src: direct reg, dst: indirect, pre-decremented reg; e.g. MOV.L Rm,@-Rn
-void TextNMFormatSrcRmDstIndrPredecRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const bool fp) {
-  auto [n, m] = GetNMFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcRmDstIndrPredecRn(const DecodedInsn &insn, OUT &result,
+                                      const bool fp) {
+  auto n = insn.n;
+  auto m = insn.m;
   if (fp) {
     REGTOFPREG(m)
-    REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = m});
   OPSEPTEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result, RegTextInfo{.regnum = n, .indirect = true, .predec = true});
 }
 
 // src: direct reg, dst: indirect, R0-indexed register; e.g. MOV.L Rm,@(R0,Rn)
-void TextNMFormatSrcRmDstIndrIdxRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const bool fp) {
-  auto [n, m] = GetNMFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcRmDstIndrIdxRn(const DecodedInsn &insn, OUT &result,
+                                   const bool fp) {
+  auto n = insn.n;
+  auto m = insn.m;
   if (fp) {
     REGTOFPREG(m)
-    REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = m});
   OPSEPTEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result, RegTextInfo{.regnum = n, .indirect = true, .indexed = true});
 }
 
 // src: indirect, R0-indexed register, dst: direct register; e.g. MOV.L
 // @(R0,Rm),Rn
-void TextNMFormatSrcIndrIdxRmDstRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, const bool fp) {
-  auto [n, m] = GetNMFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMFormatSrcIndrIdxRmDstRn(const DecodedInsn &insn, OUT &result,
+                                   const bool fp) {
+  auto n = insn.n;
+  auto m = insn.m;
   if (fp) {
-    REGTOFPREG(m)
     REGTOFPREG(n)
   }
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result, RegTextInfo{.regnum = m, .indirect = true, .indexed = true});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
 // src: indirect reg w/displacement, dst: R0; e.g. MOV.B @(disp,Rm),R0
-void TextMDFormatSrcIndrDispRmDstR0(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr) {
-  const auto [m, d] = ExtractMDFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextMDFormatSrcIndrDispRmDstR0(const DecodedInsn &insn, OUT &result) {
+  const auto m = insn.m;
+  const auto d = Displacement<SYNTAX>(insn);
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result,
       RegTextInfo{.regnum = m, .indirect = true, .use_disp = true, .disp = d});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = Registers::R0});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = Registers::R0});
 }
 
 // src: R0, dst: indirect reg w/displacement; e.g. MOV.B R0,@(disp,Rn)
-void TextND4FormatSrcR0DstIndrDispRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr) {
-  const auto [n, d] = ExtractND4FormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextND4FormatSrcR0DstIndrDispRn(const DecodedInsn &insn, OUT &result) {
+  const auto n = insn.n;
+  const auto d = Displacement<SYNTAX>(insn);
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = Registers::R0});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = Registers::R0});
   OPSEPTEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result,
       RegTextInfo{.regnum = n, .indirect = true, .use_disp = true, .disp = d});
 }
 
 // src: direct reg, dst: indirect reg w/displacement; e.g. MOV.L Rm,@(disp,Rn)
-void TextNMDFormatSrcRmDstIndrDispRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr) {
-  const auto [n, m, d] = ExtractNMDFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMDFormatSrcRmDstIndrDispRn(const DecodedInsn &insn, OUT &result) {
+  const auto n = insn.n;
+  const auto m = insn.m;
+  const auto d = Displacement<SYNTAX>(insn);
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = m});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = m});
   OPSEPTEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result,
       RegTextInfo{.regnum = n, .indirect = true, .use_disp = true, .disp = d});
 }
 
 // src: indirect reg w/displacement, dst: direct reg; e.g. MOV.L @(disp,Rm),Rn
-void TextNMDFormatSrcIndrDispRmDstRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr) {
-  const auto [n, m, d] = ExtractNMDFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextNMDFormatSrcIndrDispRmDstRn(const DecodedInsn &insn, OUT &result) {
+  const auto n = insn.n;
+  const auto m = insn.m;
+  const auto d = Displacement<SYNTAX>(insn);
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result,
       RegTextInfo{.regnum = m, .indirect = true, .use_disp = true, .disp = d});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
 // src: indirect GBR reg w/displacement, dst: R0; e.g. MOV.L @(disp,GBR),R0
-void TextDFormatSrcIndrGBRDispDstR0(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr) {
-  const auto d = ExtractDFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextDFormatSrcIndrGBRDispDstR0(const DecodedInsn &insn, OUT &result) {
+  const auto d = Displacement<SYNTAX>(insn);
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = Registers::GBR,
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = Registers::GBR,
                                              .indirect = true,
                                              .use_disp = true,
                                              .disp = d});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = Registers::R0});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = Registers::R0});
 }
 
 // src: R0, dst: indirect GBR reg w/displacement; e.g. MOV.L R0,@(disp,GBR)
-void TextDFormatSrcR0DstIndrGBRDisp(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr) {
-  const auto d = ExtractDFormatOpcodeFields(opcode);
+template <class SYNTAX, class OUT>
+void TextDFormatSrcR0DstIndrGBRDisp(const DecodedInsn &insn, OUT &result) {
+  const auto d = Displacement<SYNTAX>(insn);
 
-  ITEXT(instr)
+  ITEXT
   SPACETEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = Registers::R0});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = Registers::R0});
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = Registers::GBR,
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = Registers::GBR,
                                              .indirect = true,
                                              .use_disp = true,
                                              .disp = d});
@@ -469,1096 +542,1125 @@ void TextDFormatSrcR0DstIndrGBRDisp(
 // This text format method is specific to one instruction
 // src: indirect PC-relative displacement, dst: R0; e.g. MOVA @(disp,PC),R0 -->
 // display as MOVA #addr, R0
-void MOVATextDFormatSrcIndrPCrelDispDstR0(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, uint64_t addr) {
-  const auto d = ExtractDFormatOpcodeFields(opcode);
-  const auto target = (static_cast<uint64_t>(d) * 4) + (addr & 0xFFFFFFFC) +
-                      (2 * INSTRUCTION_SIZE);
-  std::ostringstream ss;
-  ss << "0x" << std::hex << target;
-
-  ITEXT(instr)
+template <class SYNTAX, class OUT>
+void MOVATextDFormatSrcIndrPCrelDispDstR0(const DecodedInsn &insn,
+                                          OUT &result) {
+  const auto target = insn.target;
+
+  ITEXT
   SPACETEXT
-  result.emplace_back(TextToken, "#");
-  result.emplace_back(PossibleAddressToken, ss.str(), target);
+  if constexpr (SYNTAX::ADDRESS_SIGILS) {
+    Emit(result, TextToken, "#");
+  }
+  EmitAddress(result, target);
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = Registers::R0});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = Registers::R0});
 }
 
 // src: PC-relative label; e.g. BF label
-void TextDFormatSrcPCrel(std::vector<BN::InstructionTextToken> &result,
-                         const std::string &instr, uint32_t target) {
-  ITEXT(instr)
+template <class SYNTAX, class OUT>
+void TextDFormatSrcPCrel(const DecodedInsn &insn, OUT &result) {
+  const auto target = insn.target;
+
+  ITEXT
   SPACETEXT
-  std::ostringstream ss;
-  ss << "0x" << std::hex << target;
-  result.emplace_back(PossibleAddressToken, ss.str(), target);
+  EmitAddress(result, target);
 }
 
 // src: PC-relative label; e.g. BRA label
-void TextD12FormatSrcPCrel(std::vector<BN::InstructionTextToken> &result,
-                           const std::string &instr, uint32_t target) {
-  ITEXT(instr)
+template <class SYNTAX, class OUT>
+void TextD12FormatSrcPCrel(const DecodedInsn &insn, OUT &result) {
+  const auto target = insn.target;
+
+  ITEXT
   SPACETEXT
-  std::ostringstream ss;
-  ss << "0x" << std::hex << target;
-  result.emplace_back(PossibleAddressToken, ss.str(), target);
+  EmitAddress(result, target);
 }
 
 // This text format method is specific to two instructions
 // src: PC-relative with displacement, dst: direct register; e.g. MOV.L
 // @(disp,PC),Rn --> display as MOV.L #addr, Rn
-void MOVWLTextND8FormatSrcPCrelDispDstRn(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr, size_t size, uint64_t addr) {
-  const auto [n, d] = ExtractND8FormatOpcodeFields(opcode);
-
-  std::ostringstream ss;
-  uint64_t target;
-
-  if (size == 2) {
-    target = (static_cast<uint64_t>(d) * 2) + addr + (2 * INSTRUCTION_SIZE);
-    ss << "0x" << std::hex << target;
-  } else if (size == 4) {
-    target = (static_cast<uint64_t>(d) * 4) + (addr & 0xFFFFFFFC) +
-             (2 * INSTRUCTION_SIZE);
-    ss << "0x" << std::hex << target;
-  } else {
-    BN::LogError(
-        "unexpected size (%zu) passed to MOVWLTextND8FormatSrcPCrelDispDstRn",
-        size);
-    return;
-  }
-  ITEXT(instr)
+template <class SYNTAX, class OUT>
+void MOVWLTextND8FormatSrcPCrelDispDstRn(const DecodedInsn &insn, OUT &result) {
+  const auto n = insn.n;
+  const auto target = insn.target;
+
+  ITEXT
   SPACETEXT
-  result.emplace_back(TextToken, "@");
-  result.emplace_back(PossibleAddressToken, ss.str(), target);
+  if constexpr (SYNTAX::ADDRESS_SIGILS) {
+    Emit(result, TextToken, "@");
+  }
+  EmitAddress(result, target);
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
 // src: immediate value, dst: indirect, R0-indexed GDB reg; e.g. AND.B
 // #imm,@(R0,GBR)
-void TextIFormatSrcImmDstIndrIdxGBR(
-    const uint16_t opcode, std::vector<BN::InstructionTextToken> &result,
-    const std::string &instr) {
-  const auto i = GetIFormatOpcodeField(opcode);
-
-  ITEXT(instr)
+template <class SYNTAX, class OUT>
+void TextIFormatSrcImmDstIndrIdxGBR(const DecodedInsn &insn, OUT &result) {
+  ITEXT
   SPACETEXT
-  generateImmText(result, i);
+  generateImmText<SYNTAX>(result, insn);
   OPSEPTEXT
-  GenerateRegisterTokens(
+  GenerateRegisterTokens<SYNTAX>(
       result,
       RegTextInfo{.regnum = Registers::GBR, .indirect = true, .indexed = true});
 }
 
 // src: immediate value, dst: R0; e.g. AND.B #imm,@(R0,GBR)
-void TextIFormatSrcImmDstR0(const uint16_t opcode,
-                            std::vector<BN::InstructionTextToken> &result,
-                            const std::string &instr) {
-  const auto i = GetIFormatOpcodeField(opcode);
-
-  ITEXT(instr)
+template <class SYNTAX, class OUT>
+void TextIFormatSrcImmDstR0(const DecodedInsn &insn, OUT &result) {
+  ITEXT
   SPACETEXT
-  generateImmText(result, i);
+  generateImmText<SYNTAX>(result, insn);
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = Registers::R0});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = Registers::R0});
 }
 
 // src: immediate value; e.g. TRAPA #imm
-void TextIFormatSrcImm(const uint16_t opcode,
-                       std::vector<BN::InstructionTextToken> &result,
-                       const std::string &instr) {
-  const auto i = GetIFormatOpcodeField(opcode);
-
-  ITEXT(instr)
+template <class SYNTAX, class OUT>
+void TextIFormatSrcImm(const DecodedInsn &insn, OUT &result) {
+  ITEXT
   SPACETEXT
-  generateImmText(result, i);
+  generateImmText<SYNTAX>(result, insn);
 }
 
 // src: immediate value, dst: direct reg; e.g. ADD #imm,Rn
-void TextNIFormatSrcImmDstRn(const uint16_t opcode,
-                             std::vector<BN::InstructionTextToken> &result,
-                             const std::string &instr) {
-  const auto [n, i] = ExtractNIFormatOpcodeFields(opcode);
-
-  ITEXT(instr)
+template <class SYNTAX, class OUT>
+void TextNIFormatSrcImmDstRn(const DecodedInsn &insn, OUT &result) {
+  const auto n = insn.n;
+  ITEXT
   SPACETEXT
-  generateImmText(result, i);
+  generateImmText<SYNTAX>(result, insn);
   OPSEPTEXT
-  GenerateRegisterTokens(result, RegTextInfo{.regnum = n});
+  GenerateRegisterTokens<SYNTAX>(result, RegTextInfo{.regnum = n});
 }
 
 /*
  * Instruction text methods
  */
-bool AddRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "ADD");
+template <class SYNTAX, class OUT>
+bool AddRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool AddImmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNIFormatSrcImmDstRn(opcode, result, "ADD");
+template <class SYNTAX, class OUT>
+bool AddImmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNIFormatSrcImmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool AddcRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "ADDC");
+template <class SYNTAX, class OUT>
+bool AddcRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool AddvRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "ADDV");
+template <class SYNTAX, class OUT>
+bool AddvRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool AndRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "AND");
+template <class SYNTAX, class OUT>
+bool AndRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool AndImmR0::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImmDstR0(opcode, result, "AND");
+template <class SYNTAX, class OUT>
+bool AndImmR0::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextIFormatSrcImmDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool AndbImmIndrR0Gbr::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImmDstIndrIdxGBR(opcode, result, "AND.B");
+template <class SYNTAX, class OUT>
+bool AndbImmIndrR0Gbr::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextIFormatSrcImmDstIndrIdxGBR<SYNTAX>(insn, result);
   return true;
 }
 
-bool BfDisp::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextDFormatSrcPCrel(result, "BF", GetTarget(opcode, addr));
+template <class SYNTAX, class OUT>
+bool BfDisp::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextDFormatSrcPCrel<SYNTAX>(insn, result);
   return true;
 }
 
-bool BfsDisp::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextDFormatSrcPCrel(result, "BF/S", GetTarget(opcode, addr));
+template <class SYNTAX, class OUT>
+bool BfsDisp::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextDFormatSrcPCrel<SYNTAX>(insn, result);
   return true;
 }
 
-bool BraDisp::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextD12FormatSrcPCrel(result, "BRA", GetTarget(opcode, addr));
+template <class SYNTAX, class OUT>
+bool BraDisp::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextD12FormatSrcPCrel<SYNTAX>(insn, result);
   return true;
 }
 
-bool BrafRm::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextMFormatSrcPCrelRm(opcode, result, "BRAF");
+template <class SYNTAX, class OUT>
+bool BrafRm::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextMFormatSrcPCrelRm<SYNTAX>(insn, result);
   return true;
 }
 
-bool BsrDisp::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextD12FormatSrcPCrel(result, "BSR", GetTarget(opcode, addr));
+template <class SYNTAX, class OUT>
+bool BsrDisp::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextD12FormatSrcPCrel<SYNTAX>(insn, result);
   return true;
 }
 
-bool BsrfRm::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextMFormatSrcPCrelRm(opcode, result, "BSRF");
+template <class SYNTAX, class OUT>
+bool BsrfRm::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextMFormatSrcPCrelRm<SYNTAX>(insn, result);
   return true;
 }
 
-bool BtDisp::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextDFormatSrcPCrel(result, "BT", GetTarget(opcode, addr));
+template <class SYNTAX, class OUT>
+bool BtDisp::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextDFormatSrcPCrel<SYNTAX>(insn, result);
   return true;
 }
 
-bool BtsDisp::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextDFormatSrcPCrel(result, "BT/S", GetTarget(opcode, addr));
+template <class SYNTAX, class OUT>
+bool BtsDisp::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextDFormatSrcPCrel<SYNTAX>(insn, result);
   return true;
 }
 
-bool Clrmac::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  Text0Format(result, "CLRMAC");
+template <class SYNTAX, class OUT>
+bool Clrmac::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  Text0Format<SYNTAX>(insn, result);
   return true;
 }
 
-bool Clrt::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                std::vector<BN::InstructionTextToken> &result) {
-  Text0Format(result, "CLRT");
+template <class SYNTAX, class OUT>
+bool Clrt::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                OUT &result) const {
+  Text0Format<SYNTAX>(insn, result);
   return true;
 }
 
-bool CmpEqRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "CMP/EQ");
+template <class SYNTAX, class OUT>
+bool CmpEqRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool CmpGeRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "CMP/GE");
+template <class SYNTAX, class OUT>
+bool CmpGeRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool CmpGtRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "CMP/GT");
+template <class SYNTAX, class OUT>
+bool CmpGtRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool CmpHiRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "CMP/HI");
+template <class SYNTAX, class OUT>
+bool CmpHiRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool CmpHsRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "CMP/HS");
+template <class SYNTAX, class OUT>
+bool CmpHsRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool CmpPlRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "CMP/PL");
+template <class SYNTAX, class OUT>
+bool CmpPlRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool CmpPzRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "CMP/PZ");
+template <class SYNTAX, class OUT>
+bool CmpPzRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool CmpStrRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "CMP/STR");
+template <class SYNTAX, class OUT>
+bool CmpStrRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool CmpEqImmR0::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImmDstR0(opcode, result, "CMP/EQ");
+template <class SYNTAX, class OUT>
+bool CmpEqImmR0::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextIFormatSrcImmDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool Div0sRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "DIV0S");
+template <class SYNTAX, class OUT>
+bool Div0sRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Div0u::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                 std::vector<BN::InstructionTextToken> &result) {
-  Text0Format(result, "DIV0U");
+template <class SYNTAX, class OUT>
+bool Div0u::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                 OUT &result) const {
+  Text0Format<SYNTAX>(insn, result);
   return true;
 }
 
-bool Div1RmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "DIV1");
+template <class SYNTAX, class OUT>
+bool Div1RmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool DmulslRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "DMULS.L");
+template <class SYNTAX, class OUT>
+bool DmulslRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool DmululRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "DMULU.L");
+template <class SYNTAX, class OUT>
+bool DmululRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool DtRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextNFormatDstRn(opcode, result, "DT");
+template <class SYNTAX, class OUT>
+bool DtRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool ExtsbRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "EXTS.B");
+template <class SYNTAX, class OUT>
+bool ExtsbRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool ExtswRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "EXTS.W");
+template <class SYNTAX, class OUT>
+bool ExtswRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool ExtubRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "EXTU.B");
+template <class SYNTAX, class OUT>
+bool ExtubRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool ExtuwRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "EXTU.W");
+template <class SYNTAX, class OUT>
+bool ExtuwRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool JmpIndrRm::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcIndrRm(opcode, result, "JMP");
+template <class SYNTAX, class OUT>
+bool JmpIndrRm::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextMFormatSrcIndrRm<SYNTAX>(insn, result);
   return true;
 }
 
-bool JsrIndrRm::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcIndrRm(opcode, result, "JSR");
+template <class SYNTAX, class OUT>
+bool JsrIndrRm::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextMFormatSrcIndrRm<SYNTAX>(insn, result);
   return true;
 }
 
-bool LdcRmSr::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcRmDstCtrlSysReg(opcode, result, "LDC", Registers::SR);
+template <class SYNTAX, class OUT>
+bool LdcRmSr::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextMFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::SR);
   return true;
 }
 
-bool LdcRmGbr::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcRmDstCtrlSysReg(opcode, result, "LDC", Registers::GBR);
+template <class SYNTAX, class OUT>
+bool LdcRmGbr::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextMFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::GBR);
   return true;
 }
 
-bool LdcRmVbr::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcRmDstCtrlSysReg(opcode, result, "LDC", Registers::VBR);
+template <class SYNTAX, class OUT>
+bool LdcRmVbr::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextMFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::VBR);
   return true;
 }
 
-bool LdclIndrRmPostincSr::Text(const uint16_t opcode, const uint64_t addr,
-                               size_t &len,
-                               std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcIndrPostincRmDstCtrlSysReg(opcode, result, "LDC.L",
-                                           Registers::SR);
+template <class SYNTAX, class OUT>
+bool LdclIndrRmPostincSr::Text(const DecodedInsn &insn, const uint64_t addr,
+                               size_t &len, OUT &result) const {
+  TextMFormatSrcIndrPostincRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::SR);
   return true;
 }
 
-bool LdclIndrRmPostincGbr::Text(const uint16_t opcode, const uint64_t addr,
-                                size_t &len,
-                                std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcIndrPostincRmDstCtrlSysReg(opcode, result, "LDC.L",
-                                           Registers::GBR);
+template <class SYNTAX, class OUT>
+bool LdclIndrRmPostincGbr::Text(const DecodedInsn &insn, const uint64_t addr,
+                                size_t &len, OUT &result) const {
+  TextMFormatSrcIndrPostincRmDstCtrlSysReg<SYNTAX>(insn, result,
+                                                   Registers::GBR);
   return true;
 }
 
-bool LdclIndrRmPostincVbr::Text(const uint16_t opcode, const uint64_t addr,
-                                size_t &len,
-                                std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcIndrPostincRmDstCtrlSysReg(opcode, result, "LDC.L",
-                                           Registers::VBR);
+template <class SYNTAX, class OUT>
+bool LdclIndrRmPostincVbr::Text(const DecodedInsn &insn, const uint64_t addr,
+                                size_t &len, OUT &result) const {
+  TextMFormatSrcIndrPostincRmDstCtrlSysReg<SYNTAX>(insn, result,
+                                                   Registers::VBR);
   return true;
 }
 
-bool LdsRmMach::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcRmDstCtrlSysReg(opcode, result, "LDS", Registers::MACH);
+template <class SYNTAX, class OUT>
+bool LdsRmMach::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextMFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::MACH);
   return true;
 }
 
-bool LdsRmMacl::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcRmDstCtrlSysReg(opcode, result, "LDS", Registers::MACL);
+template <class SYNTAX, class OUT>
+bool LdsRmMacl::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextMFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::MACL);
   return true;
 }
 
-bool LdsRmPr::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcRmDstCtrlSysReg(opcode, result, "LDS", Registers::PR);
+template <class SYNTAX, class OUT>
+bool LdsRmPr::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextMFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::PR);
   return true;
 }
 
-bool LdslIndrRmPostincMach::Text(
-    const uint16_t opcode, const uint64_t addr, size_t &len,
-    std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcIndrPostincRmDstCtrlSysReg(opcode, result, "LDS.L",
-                                           Registers::MACH);
+template <class SYNTAX, class OUT>
+bool LdslIndrRmPostincMach::Text(const DecodedInsn &insn, const uint64_t addr,
+                                 size_t &len, OUT &result) const {
+  TextMFormatSrcIndrPostincRmDstCtrlSysReg<SYNTAX>(insn, result,
+                                                   Registers::MACH);
   return true;
 }
 
-bool LdslIndrRmPostincMacl::Text(
-    const uint16_t opcode, const uint64_t addr, size_t &len,
-    std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcIndrPostincRmDstCtrlSysReg(opcode, result, "LDS.L",
-                                           Registers::MACL);
+template <class SYNTAX, class OUT>
+bool LdslIndrRmPostincMacl::Text(const DecodedInsn &insn, const uint64_t addr,
+                                 size_t &len, OUT &result) const {
+  TextMFormatSrcIndrPostincRmDstCtrlSysReg<SYNTAX>(insn, result,
+                                                   Registers::MACL);
   return true;
 }
 
-bool LdslIndrRmPostincPr::Text(const uint16_t opcode, const uint64_t addr,
-                               size_t &len,
-                               std::vector<BN::InstructionTextToken> &result) {
-  TextMFormatSrcIndrPostincRmDstCtrlSysReg(opcode, result, "LDS.L",
-                                           Registers::PR);
+template <class SYNTAX, class OUT>
+bool LdslIndrRmPostincPr::Text(const DecodedInsn &insn, const uint64_t addr,
+                               size_t &len, OUT &result) const {
+  TextMFormatSrcIndrPostincRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::PR);
   return true;
 }
 
-bool MaclIndrRmPostincIndrRnPostinc::Text(
-    const uint16_t opcode, const uint64_t addr, size_t &len,
-    std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextNMFormatSrcIndrPostincRmRnDstMAC(opcode, result, "MAC.L");
+template <class SYNTAX, class OUT>
+bool MaclIndrRmPostincIndrRnPostinc::Text(const DecodedInsn &insn,
+                                          const uint64_t addr, size_t &len,
+                                          OUT &result) const {
+  TextNMFormatSrcIndrPostincRmRnDstMAC<SYNTAX>(insn, result);
   return true;
 }
 
-bool MacwIndrRmPostincIndrRnPostinc::Text(
-    const uint16_t opcode, const uint64_t addr, size_t &len,
-    std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextNMFormatSrcIndrPostincRmRnDstMAC(opcode, result, "MAC.W");
+template <class SYNTAX, class OUT>
+bool MacwIndrRmPostincIndrRnPostinc::Text(const DecodedInsn &insn,
+                                          const uint64_t addr, size_t &len,
+                                          OUT &result) const {
+  TextNMFormatSrcIndrPostincRmRnDstMAC<SYNTAX>(insn, result);
   return true;
 }
 
-bool MacIndrRmPostincIndrRnPostinc::Text(
-    const uint16_t opcode, const uint64_t addr, size_t &len,
-    std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrPostincRmRnDstMAC(opcode, result, "MAC");
+template <class SYNTAX, class OUT>
+bool MacIndrRmPostincIndrRnPostinc::Text(const DecodedInsn &insn,
+                                         const uint64_t addr, size_t &len,
+                                         OUT &result) const {
+  TextNMFormatSrcIndrPostincRmRnDstMAC<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "MOV");
+template <class SYNTAX, class OUT>
+bool MovRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbRmIndrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                        std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstIndrRn(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbRmIndrRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                        size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwRmIndrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                        std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstIndrRn(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwRmIndrRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                        size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlRmIndrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                        std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstIndrRn(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlRmIndrRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                        size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbIndrRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                        std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrRmDstRn(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbIndrRmRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                        size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwIndrRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                        std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrRmDstRn(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwIndrRmRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                        size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlIndrRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                        std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrRmDstRn(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlIndrRmRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                        size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbRmIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                              size_t &len,
-                              std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstIndrPredecRn(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbRmIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                              size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrPredecRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwRmIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                              size_t &len,
-                              std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstIndrPredecRn(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwRmIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                              size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrPredecRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlRmIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                              size_t &len,
-                              std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstIndrPredecRn(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlRmIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                              size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrPredecRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbIndrRmPostincRn::Text(const uint16_t opcode, const uint64_t addr,
-                               size_t &len,
-                               std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrPostincRmDstRn(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbIndrRmPostincRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                               size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrPostincRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwIndrRmPostincRn::Text(const uint16_t opcode, const uint64_t addr,
-                               size_t &len,
-                               std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrPostincRmDstRn(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwIndrRmPostincRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                               size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrPostincRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlIndrRmPostincRn::Text(const uint16_t opcode, const uint64_t addr,
-                               size_t &len,
-                               std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrPostincRmDstRn(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlIndrRmPostincRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                               size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrPostincRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbRmIndrR0Rn::Text(const uint16_t opcode, const uint64_t addr,
-                          size_t &len,
-                          std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstIndrIdxRn(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbRmIndrR0Rn::Text(const DecodedInsn &insn, const uint64_t addr,
+                          size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrIdxRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwRmIndrR0Rn::Text(const uint16_t opcode, const uint64_t addr,
-                          size_t &len,
-                          std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstIndrIdxRn(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwRmIndrR0Rn::Text(const DecodedInsn &insn, const uint64_t addr,
+                          size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrIdxRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlRmIndrR0Rn::Text(const uint16_t opcode, const uint64_t addr,
-                          size_t &len,
-                          std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstIndrIdxRn(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlRmIndrR0Rn::Text(const DecodedInsn &insn, const uint64_t addr,
+                          size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrIdxRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbIndrR0RmRn::Text(const uint16_t opcode, const uint64_t addr,
-                          size_t &len,
-                          std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrIdxRmDstRn(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbIndrR0RmRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                          size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrIdxRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwIndrR0RmRn::Text(const uint16_t opcode, const uint64_t addr,
-                          size_t &len,
-                          std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrIdxRmDstRn(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwIndrR0RmRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                          size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrIdxRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlIndrR0RmRn::Text(const uint16_t opcode, const uint64_t addr,
-                          size_t &len,
-                          std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcIndrIdxRmDstRn(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlIndrR0RmRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                          size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrIdxRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovImmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNIFormatSrcImmDstRn(opcode, result, "MOV");
+template <class SYNTAX, class OUT>
+bool MovImmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNIFormatSrcImmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwIndrDispPcRn::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  MOVWLTextND8FormatSrcPCrelDispDstRn(opcode, result, "MOV.W", 2, addr);
+template <class SYNTAX, class OUT>
+bool MovwIndrDispPcRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  MOVWLTextND8FormatSrcPCrelDispDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlIndrDispPcRn::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  MOVWLTextND8FormatSrcPCrelDispDstRn(opcode, result, "MOV.L", 4, addr);
+template <class SYNTAX, class OUT>
+bool MovlIndrDispPcRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  MOVWLTextND8FormatSrcPCrelDispDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbIndrDispGbrR0::Text(const uint16_t opcode, const uint64_t addr,
-                             size_t &len,
-                             std::vector<BN::InstructionTextToken> &result) {
-  TextDFormatSrcIndrGBRDispDstR0(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbIndrDispGbrR0::Text(const DecodedInsn &insn, const uint64_t addr,
+                             size_t &len, OUT &result) const {
+  TextDFormatSrcIndrGBRDispDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwIndrDispGbrR0::Text(const uint16_t opcode, const uint64_t addr,
-                             size_t &len,
-                             std::vector<BN::InstructionTextToken> &result) {
-  TextDFormatSrcIndrGBRDispDstR0(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwIndrDispGbrR0::Text(const DecodedInsn &insn, const uint64_t addr,
+                             size_t &len, OUT &result) const {
+  TextDFormatSrcIndrGBRDispDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlIndrDispGbrR0::Text(const uint16_t opcode, const uint64_t addr,
-                             size_t &len,
-                             std::vector<BN::InstructionTextToken> &result) {
-  TextDFormatSrcIndrGBRDispDstR0(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlIndrDispGbrR0::Text(const DecodedInsn &insn, const uint64_t addr,
+                             size_t &len, OUT &result) const {
+  TextDFormatSrcIndrGBRDispDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbR0IndrDispGbr::Text(const uint16_t opcode, const uint64_t addr,
-                             size_t &len,
-                             std::vector<BN::InstructionTextToken> &result) {
-  TextDFormatSrcR0DstIndrGBRDisp(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbR0IndrDispGbr::Text(const DecodedInsn &insn, const uint64_t addr,
+                             size_t &len, OUT &result) const {
+  TextDFormatSrcR0DstIndrGBRDisp<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwR0IndrDispGbr::Text(const uint16_t opcode, const uint64_t addr,
-                             size_t &len,
-                             std::vector<BN::InstructionTextToken> &result) {
-  TextDFormatSrcR0DstIndrGBRDisp(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwR0IndrDispGbr::Text(const DecodedInsn &insn, const uint64_t addr,
+                             size_t &len, OUT &result) const {
+  TextDFormatSrcR0DstIndrGBRDisp<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlR0IndrDispGbr::Text(const uint16_t opcode, const uint64_t addr,
-                             size_t &len,
-                             std::vector<BN::InstructionTextToken> &result) {
-  TextDFormatSrcR0DstIndrGBRDisp(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlR0IndrDispGbr::Text(const DecodedInsn &insn, const uint64_t addr,
+                             size_t &len, OUT &result) const {
+  TextDFormatSrcR0DstIndrGBRDisp<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbR0IndrDispRn::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  TextND4FormatSrcR0DstIndrDispRn(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbR0IndrDispRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextND4FormatSrcR0DstIndrDispRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwR0IndrDispRn::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  TextND4FormatSrcR0DstIndrDispRn(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwR0IndrDispRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextND4FormatSrcR0DstIndrDispRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlRmIndrDispRn::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  TextNMDFormatSrcRmDstIndrDispRn(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlRmIndrDispRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextNMDFormatSrcRmDstIndrDispRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovbIndrDispRmR0::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  TextMDFormatSrcIndrDispRmDstR0(opcode, result, "MOV.B");
+template <class SYNTAX, class OUT>
+bool MovbIndrDispRmR0::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextMDFormatSrcIndrDispRmDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovwIndrDispRmR0::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  TextMDFormatSrcIndrDispRmDstR0(opcode, result, "MOV.W");
+template <class SYNTAX, class OUT>
+bool MovwIndrDispRmR0::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextMDFormatSrcIndrDispRmDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovlIndrDispRmRn::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  TextNMDFormatSrcIndrDispRmDstRn(opcode, result, "MOV.L");
+template <class SYNTAX, class OUT>
+bool MovlIndrDispRmRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextNMDFormatSrcIndrDispRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovaIndrDispPcR0::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  MOVATextDFormatSrcIndrPCrelDispDstR0(opcode, result, "MOVA", addr);
+template <class SYNTAX, class OUT>
+bool MovaIndrDispPcR0::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  MOVATextDFormatSrcIndrPCrelDispDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool MovtRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "MOVT");
+template <class SYNTAX, class OUT>
+bool MovtRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MullRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() == SH_1_ISA) {
-    // unimplemented on SH-1
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "MUL.L");
+template <class SYNTAX, class OUT>
+bool MullRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MulswRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "MULS.W");
+template <class SYNTAX, class OUT>
+bool MulswRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MulsRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "MULS");
+template <class SYNTAX, class OUT>
+bool MulsRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MuluwRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "MULU.W");
+template <class SYNTAX, class OUT>
+bool MuluwRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool MuluRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "MULU");
+template <class SYNTAX, class OUT>
+bool MuluRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool NegRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "NEG");
+template <class SYNTAX, class OUT>
+bool NegRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool NegcRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "NEGC");
+template <class SYNTAX, class OUT>
+bool NegcRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Nop::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-               std::vector<BN::InstructionTextToken> &result) {
-  Text0Format(result, "NOP");
+template <class SYNTAX, class OUT>
+bool Nop::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+               OUT &result) const {
+  Text0Format<SYNTAX>(insn, result);
   return true;
 }
 
-bool NotRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "NOT");
+template <class SYNTAX, class OUT>
+bool NotRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool OrRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "OR");
+template <class SYNTAX, class OUT>
+bool OrRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool OrImmR0::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImmDstR0(opcode, result, "OR");
+template <class SYNTAX, class OUT>
+bool OrImmR0::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextIFormatSrcImmDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool OrbImmIndrR0Gbr::Text(const uint16_t opcode, const uint64_t addr,
-                           size_t &len,
-                           std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImmDstIndrIdxGBR(opcode, result, "OR.B");
+template <class SYNTAX, class OUT>
+bool OrbImmIndrR0Gbr::Text(const DecodedInsn &insn, const uint64_t addr,
+                           size_t &len, OUT &result) const {
+  TextIFormatSrcImmDstIndrIdxGBR<SYNTAX>(insn, result);
   return true;
 }
 
-bool RotclRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "ROTCL");
+template <class SYNTAX, class OUT>
+bool RotclRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool RotcrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "ROTCR");
+template <class SYNTAX, class OUT>
+bool RotcrRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool RotlRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "ROTL");
+template <class SYNTAX, class OUT>
+bool RotlRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool RotrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "ROTR");
+template <class SYNTAX, class OUT>
+bool RotrRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Rte::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-               std::vector<BN::InstructionTextToken> &result) {
-  Text0Format(result, "RTE");
+template <class SYNTAX, class OUT>
+bool Rte::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+               OUT &result) const {
+  Text0Format<SYNTAX>(insn, result);
   return true;
 }
 
-bool Rts::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-               std::vector<BN::InstructionTextToken> &result) {
-  Text0Format(result, "RTS");
+template <class SYNTAX, class OUT>
+bool Rts::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+               OUT &result) const {
+  Text0Format<SYNTAX>(insn, result);
   return true;
 }
 
-bool Sett::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                std::vector<BN::InstructionTextToken> &result) {
-  Text0Format(result, "SETT");
+template <class SYNTAX, class OUT>
+bool Sett::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                OUT &result) const {
+  Text0Format<SYNTAX>(insn, result);
   return true;
 }
 
-bool ShalRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHAL");
+template <class SYNTAX, class OUT>
+bool ShalRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool SharRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHAR");
+template <class SYNTAX, class OUT>
+bool SharRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool ShllRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHLL");
+template <class SYNTAX, class OUT>
+bool ShllRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Shll2Rn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHLL2");
+template <class SYNTAX, class OUT>
+bool Shll2Rn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Shll8Rn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHLL8");
+template <class SYNTAX, class OUT>
+bool Shll8Rn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Shll16Rn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHLL16");
+template <class SYNTAX, class OUT>
+bool Shll16Rn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool ShlrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                  std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHLR");
+template <class SYNTAX, class OUT>
+bool ShlrRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Shlr2Rn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHLR2");
+template <class SYNTAX, class OUT>
+bool Shlr2Rn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Shlr8Rn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHLR8");
+template <class SYNTAX, class OUT>
+bool Shlr8Rn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Shlr16Rn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstRn(opcode, result, "SHLR16");
+template <class SYNTAX, class OUT>
+bool Shlr16Rn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool Sleep::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                 std::vector<BN::InstructionTextToken> &result) {
-  Text0Format(result, "SLEEP");
+template <class SYNTAX, class OUT>
+bool Sleep::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                 OUT &result) const {
+  Text0Format<SYNTAX>(insn, result);
   return true;
 }
 
-bool StcSrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "STC", Registers::SR);
+template <class SYNTAX, class OUT>
+bool StcSrRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::SR);
   return true;
 }
 
-bool StcGbrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "STC", Registers::GBR);
+template <class SYNTAX, class OUT>
+bool StcGbrRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::GBR);
   return true;
 }
 
-bool StcVbrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "STC", Registers::VBR);
+template <class SYNTAX, class OUT>
+bool StcVbrRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::VBR);
   return true;
 }
 
-bool StclSrIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                              size_t &len,
-                              std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstIndrPredecRn(opcode, result, "STC.L",
-                                          Registers::SR);
+template <class SYNTAX, class OUT>
+bool StclSrIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                              size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstIndrPredecRn<SYNTAX>(insn, result, Registers::SR);
   return true;
 }
 
-bool StclGbrIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                               size_t &len,
-                               std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstIndrPredecRn(opcode, result, "STC.L",
-                                          Registers::GBR);
+template <class SYNTAX, class OUT>
+bool StclGbrIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                               size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstIndrPredecRn<SYNTAX>(insn, result, Registers::GBR);
   return true;
 }
 
-bool StclVbrIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                               size_t &len,
-                               std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstIndrPredecRn(opcode, result, "STC.L",
-                                          Registers::VBR);
+template <class SYNTAX, class OUT>
+bool StclVbrIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                               size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstIndrPredecRn<SYNTAX>(insn, result, Registers::VBR);
   return true;
 }
 
-bool StsMachRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "STS", Registers::MACH);
+template <class SYNTAX, class OUT>
+bool StsMachRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::MACH);
   return true;
 }
 
-bool StsMaclRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "STS", Registers::MACL);
+template <class SYNTAX, class OUT>
+bool StsMaclRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::MACL);
   return true;
 }
 
-bool StsPrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "STS", Registers::PR);
+template <class SYNTAX, class OUT>
+bool StsPrRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::PR);
   return true;
 }
 
-bool StslMachIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                                size_t &len,
-                                std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstIndrPredecRn(opcode, result, "STS.L",
-                                          Registers::MACH);
+template <class SYNTAX, class OUT>
+bool StslMachIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                                size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstIndrPredecRn<SYNTAX>(insn, result,
+                                                  Registers::MACH);
   return true;
 }
 
-bool StslMaclIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                                size_t &len,
-                                std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstIndrPredecRn(opcode, result, "STS.L",
-                                          Registers::MACL);
+template <class SYNTAX, class OUT>
+bool StslMaclIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                                size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstIndrPredecRn<SYNTAX>(insn, result,
+                                                  Registers::MACL);
   return true;
 }
 
-bool StslPrIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                              size_t &len,
-                              std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatSrcCtrlSysRegDstIndrPredecRn(opcode, result, "STS.L",
-                                          Registers::PR);
+template <class SYNTAX, class OUT>
+bool StslPrIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                              size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstIndrPredecRn<SYNTAX>(insn, result, Registers::PR);
   return true;
 }
 
-bool SubRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "SUB");
+template <class SYNTAX, class OUT>
+bool SubRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool SubcRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "SUBC");
+template <class SYNTAX, class OUT>
+bool SubcRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool SubvRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "SUBV");
+template <class SYNTAX, class OUT>
+bool SubvRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool SwapbRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "SWAP.B");
+template <class SYNTAX, class OUT>
+bool SwapbRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool SwapwRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "SWAP.W");
+template <class SYNTAX, class OUT>
+bool SwapwRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool TasbIndrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  TextNFormatDstIndrRn(opcode, result, "TAS.B");
+template <class SYNTAX, class OUT>
+bool TasbIndrRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNFormatDstIndrRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool TrapaImm::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImm(opcode, result, "TRAPA");
+template <class SYNTAX, class OUT>
+bool TrapaImm::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextIFormatSrcImm<SYNTAX>(insn, result);
   return true;
 }
 
-bool TstRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "TST");
+template <class SYNTAX, class OUT>
+bool TstRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool TstImmR0::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImmDstR0(opcode, result, "TST");
+template <class SYNTAX, class OUT>
+bool TstImmR0::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextIFormatSrcImmDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool TstbImmIndrR0Gbr::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImmDstIndrIdxGBR(opcode, result, "TST.B");
+template <class SYNTAX, class OUT>
+bool TstbImmIndrR0Gbr::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextIFormatSrcImmDstIndrIdxGBR<SYNTAX>(insn, result);
   return true;
 }
 
-bool XorRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "XOR");
+template <class SYNTAX, class OUT>
+bool XorRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool XorImmR0::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImmDstR0(opcode, result, "XOR");
+template <class SYNTAX, class OUT>
+bool XorImmR0::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextIFormatSrcImmDstR0<SYNTAX>(insn, result);
   return true;
 }
 
-bool XorbImmIndrR0Gbr::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  TextIFormatSrcImmDstIndrIdxGBR(opcode, result, "XOR.B");
+template <class SYNTAX, class OUT>
+bool XorbImmIndrR0Gbr::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextIFormatSrcImmDstIndrIdxGBR<SYNTAX>(insn, result);
   return true;
 }
 
-bool XtrctRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  TextNMFormatSrcRmDstRn(opcode, result, "XTRCT");
+template <class SYNTAX, class OUT>
+bool XtrctRmRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result);
   return true;
 }
 
@@ -1567,288 +1669,244 @@ bool XtrctRmRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
  * SH-2E Only
  */
 
-bool FabsFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatDstRn(opcode, result, "FABS", true);
+template <class SYNTAX, class OUT>
+bool FabsFrn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FaddFrmFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "FADD", true);
+template <class SYNTAX, class OUT>
+bool FaddFrmFrn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FcmpEqFrmFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                        std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "FCMP/EQ", true);
+template <class SYNTAX, class OUT>
+bool FcmpEqFrmFrn::Text(const DecodedInsn &insn, const uint64_t addr,
+                        size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FcmpGtFrmFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                        std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "FCMP/GT", true);
+template <class SYNTAX, class OUT>
+bool FcmpGtFrmFrn::Text(const DecodedInsn &insn, const uint64_t addr,
+                        size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FdivFrmFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "FDIV", true);
+template <class SYNTAX, class OUT>
+bool FdivFrmFrn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool Fldi0Frn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatDstRn(opcode, result, "FLDI0", true);
+template <class SYNTAX, class OUT>
+bool Fldi0Frn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool Fldi1Frn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                    std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatDstRn(opcode, result, "FLDI1", true);
+template <class SYNTAX, class OUT>
+bool Fldi1Frn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                    OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FldsFrmFpul::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                       std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcRmDstCtrlSysReg(opcode, result, "FLDS", Registers::FPUL, true);
+template <class SYNTAX, class OUT>
+bool FldsFrmFpul::Text(const DecodedInsn &insn, const uint64_t addr,
+                       size_t &len, OUT &result) const {
+  TextNFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::FPUL, true);
   return true;
 }
 
-bool FloatFpulFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                        std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "FLOAT", Registers::FPUL, true);
+template <class SYNTAX, class OUT>
+bool FloatFpulFrn::Text(const DecodedInsn &insn, const uint64_t addr,
+                        size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::FPUL, true);
   return true;
 }
 
-bool FmacFr0FrmFrn::Text(const uint16_t opcode, const uint64_t addr,
-                         size_t &len,
-                         std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatFR0FRmFRn(opcode, result, "FMAC");
+template <class SYNTAX, class OUT>
+bool FmacFr0FrmFrn::Text(const DecodedInsn &insn, const uint64_t addr,
+                         size_t &len, OUT &result) const {
+  TextNMFormatFR0FRmFRn<SYNTAX>(insn, result);
   return true;
 }
 
-bool FmovFrmFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "FMOV", true);
+template <class SYNTAX, class OUT>
+bool FmovFrmFrn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FmovsIndrRmFrn::Text(const uint16_t opcode, const uint64_t addr,
-                          size_t &len,
-                          std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcIndrRmDstRn(opcode, result, "FMOV.S", true);
+template <class SYNTAX, class OUT>
+bool FmovsIndrRmFrn::Text(const DecodedInsn &insn, const uint64_t addr,
+                          size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FmovsFrmIndrRn::Text(const uint16_t opcode, const uint64_t addr,
-                          size_t &len,
-                          std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstIndrRn(opcode, result, "FMOV.S", true);
+template <class SYNTAX, class OUT>
+bool FmovsFrmIndrRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                          size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FmovsIndrRmPostincFrn::Text(
-    const uint16_t opcode, const uint64_t addr, size_t &len,
-    std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcIndrPostincRmDstRn(opcode, result, "FMOV.S", true);
+template <class SYNTAX, class OUT>
+bool FmovsIndrRmPostincFrn::Text(const DecodedInsn &insn, const uint64_t addr,
+                                 size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrPostincRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FmovsFrmIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                                size_t &len,
-                                std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstIndrPredecRn(opcode, result, "FMOV.S", true);
+template <class SYNTAX, class OUT>
+bool FmovsFrmIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                                size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrPredecRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FmovsIndrR0RmFrn::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcIndrIdxRmDstRn(opcode, result, "FMOV.S", true);
+template <class SYNTAX, class OUT>
+bool FmovsIndrR0RmFrn::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextNMFormatSrcIndrIdxRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FmovsFrmIndrR0Rn::Text(const uint16_t opcode, const uint64_t addr,
-                            size_t &len,
-                            std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstIndrIdxRn(opcode, result, "FMOV.S", true);
+template <class SYNTAX, class OUT>
+bool FmovsFrmIndrR0Rn::Text(const DecodedInsn &insn, const uint64_t addr,
+                            size_t &len, OUT &result) const {
+  TextNMFormatSrcRmDstIndrIdxRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FmulFrmFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "FMUL", true);
+template <class SYNTAX, class OUT>
+bool FmulFrmFrn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FnegFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                   std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatDstRn(opcode, result, "FNEG", true);
+template <class SYNTAX, class OUT>
+bool FnegFrn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                   OUT &result) const {
+  TextNFormatDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FstsFpulFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                       std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "FSTS", Registers::FPUL, true);
+template <class SYNTAX, class OUT>
+bool FstsFpulFrn::Text(const DecodedInsn &insn, const uint64_t addr,
+                       size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::FPUL, true);
   return true;
 }
 
-bool FsubFrmFrn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNMFormatSrcRmDstRn(opcode, result, "FSUB", true);
+template <class SYNTAX, class OUT>
+bool FsubFrmFrn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNMFormatSrcRmDstRn<SYNTAX>(insn, result, true);
   return true;
 }
 
-bool FtrcFrmFpul::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                       std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcRmDstCtrlSysReg(opcode, result, "FTRC", Registers::FPUL, true);
+template <class SYNTAX, class OUT>
+bool FtrcFrmFpul::Text(const DecodedInsn &insn, const uint64_t addr,
+                       size_t &len, OUT &result) const {
+  TextNFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::FPUL, true);
   return true;
 }
 
-bool LdsRmFpul::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcRmDstCtrlSysReg(opcode, result, "LDS", Registers::FPUL, true);
+template <class SYNTAX, class OUT>
+bool LdsRmFpul::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::FPUL);
   return true;
 }
 
-bool LdslIndrRmPostincFpul::Text(
-    const uint16_t opcode, const uint64_t addr, size_t &len,
-    std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcIndrPostincRmDstCtrlSysReg(opcode, result, "LDS.L",
-                                           Registers::FPUL, true);
+template <class SYNTAX, class OUT>
+bool LdslIndrRmPostincFpul::Text(const DecodedInsn &insn, const uint64_t addr,
+                                 size_t &len, OUT &result) const {
+  TextNFormatSrcIndrPostincRmDstCtrlSysReg<SYNTAX>(insn, result,
+                                                   Registers::FPUL);
   return true;
 }
 
-bool LdsRmFpscr::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcRmDstCtrlSysReg(opcode, result, "LDS", Registers::FPSCR, true);
+template <class SYNTAX, class OUT>
+bool LdsRmFpscr::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNFormatSrcRmDstCtrlSysReg<SYNTAX>(insn, result, Registers::FPSCR);
   return true;
 }
 
-bool LdslIndrRmPostincFpscr::Text(
-    const uint16_t opcode, const uint64_t addr, size_t &len,
-    std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcIndrPostincRmDstCtrlSysReg(opcode, result, "LDS.L",
-                                           Registers::FPSCR, true);
+template <class SYNTAX, class OUT>
+bool LdslIndrRmPostincFpscr::Text(const DecodedInsn &insn, const uint64_t addr,
+                                  size_t &len, OUT &result) const {
+  TextNFormatSrcIndrPostincRmDstCtrlSysReg<SYNTAX>(insn, result,
+                                                   Registers::FPSCR);
   return true;
 }
 
-bool StsFpulRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                     std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "STS", Registers::FPUL, true);
+template <class SYNTAX, class OUT>
+bool StsFpulRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                     OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::FPUL);
   return true;
 }
 
-bool StslFpulIndrPredecRn::Text(const uint16_t opcode, const uint64_t addr,
-                                size_t &len,
-                                std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcCtrlSysRegDstIndrPredecRn(opcode, result, "STS.L",
-                                          Registers::FPUL, true);
+template <class SYNTAX, class OUT>
+bool StslFpulIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                                size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstIndrPredecRn<SYNTAX>(insn, result,
+                                                  Registers::FPUL);
   return true;
 }
 
-bool StsFpscrRn::Text(const uint16_t opcode, const uint64_t addr, size_t &len,
-                      std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcCtrlSysRegDstRn(opcode, result, "STS", Registers::FPSCR, true);
+template <class SYNTAX, class OUT>
+bool StsFpscrRn::Text(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                      OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstRn<SYNTAX>(insn, result, Registers::FPSCR);
   return true;
 }
 
-bool StslFpscrIndrPredecRn::Text(
-    const uint16_t opcode, const uint64_t addr, size_t &len,
-    std::vector<BN::InstructionTextToken> &result) {
-  if (this->GetIsaType() != SH_2E_ISA) {
-    return false;
-  }
-  TextNFormatSrcCtrlSysRegDstIndrPredecRn(opcode, result, "STS.L",
-                                          Registers::FPSCR, true);
+template <class SYNTAX, class OUT>
+bool StslFpscrIndrPredecRn::Text(const DecodedInsn &insn, const uint64_t addr,
+                                 size_t &len, OUT &result) const {
+  TextNFormatSrcCtrlSysRegDstIndrPredecRn<SYNTAX>(insn, result,
+                                                  Registers::FPSCR);
   return true;
 }
+
+template <class SYNTAX, class OUT>
+bool DispatchText(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  OUT &result) {
+  if constexpr (std::is_same_v<OUT, Tokens>) {
+    result.reserve(result.size() + TokenCount(insn.id));
+  }
+  return Visit(insn.id, [&](const auto &i) {
+    return i.template Text<SYNTAX>(insn, addr, len, result);
+  });
+}
+
+template bool DispatchText<RenesasSyntax>(const DecodedInsn &insn,
+                                          uint64_t addr, size_t &len,
+                                          Tokens &result);
+template bool DispatchText<GnuSyntax>(const DecodedInsn &insn, uint64_t addr,
+                                      size_t &len, Tokens &result);
+template bool DispatchText<RenesasSyntax>(const DecodedInsn &insn,
+                                          uint64_t addr, size_t &len,
+                                          TextWriter &result);
+template bool DispatchText<GnuSyntax>(const DecodedInsn &insn, uint64_t addr,
+                                      size_t &len, TextWriter &result);
+
+bool DispatchText(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+                  Tokens &result) {
+  return DispatchText<RenesasSyntax>(insn, addr, len, result);
+}
 }  // namespace SuperH
@@ -0,0 +1,156 @@
+// Copyright (c) 2025. Battelle Energy Alliance, LLC
+// ALL RIGHTS RESERVED
+
+#ifndef SRC_TEXT_CACHE_H_
+#define SRC_TEXT_CACHE_H_
+
+#include <binaryninjaapi.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "hex.h"
+#include "instructions.h"
+#include "syntax.h"
+
+namespace BN = BinaryNinja;
+
+namespace SuperH {
+// DispatchText instantiated for one syntax
+using TextRenderer = bool (*)(const DecodedInsn &insn, uint64_t addr,
+                              size_t &len,
+                              std::vector<BN::InstructionTextToken> &result);
+
+inline TextRenderer GetTextRenderer(const Syntax syntax) {
+  return WithSyntax(syntax, [](const auto policy) -> TextRenderer {
+    return &DispatchText<std::decay_t<decltype(policy)>>;
+  });
+}
+
+/*
+ * Tokens of every opcode rendered so far on one architecture, so that text
+ * for an opcode is formatted only the first time it is seen.
+ *
+ * An instruction renders to the same tokens wherever it appears, except that
+ * PC-relative forms show their resolved target; for those, the one address
+ * token is patched from the DecodedInsn of each call. Templates are built
+ * lazily, published with a compare-and-swap and never modified afterwards,
+ * so lookups from analysis threads never lock.
+ *
+ * Memory: slots for the 64K opcodes are allocated a page of 256 at a time
+ * when an opcode in the page is first seen, so a cache costs 2 KB plus 2 KB
+ * per page used, 514 KB at most. At most MAX_TEMPLATES templates of roughly
+ * 1 KB are kept, until the cache is destroyed; once that many are built,
+ * other opcodes are formatted on every call instead.
+ */
+class TextCache {
+ public:
+  static constexpr size_t MAX_TEMPLATES = 4096;
+
+  explicit TextCache(
+      const TextRenderer render = GetTextRenderer(Syntax::RENESAS))
+      : render(render) {}
+  TextCache(const TextCache &) = delete;
+  TextCache &operator=(const TextCache &) = delete;
+
+  ~TextCache() {
+    for (auto &entry : pages) {
+      const Page *page = entry.load(std::memory_order_relaxed);
+      if (page == nullptr) {
+        continue;
+      }
+      for (auto &slot : page->slots) {
+        delete slot.load(std::memory_order_relaxed);
+      }
+      delete page;
+    }
+  }
+
+  // Appends the tokens of `insn` at `addr` to `result`. Same contract as
+  // the renderer, e.g. DispatchText(insn, addr, len, result)
+  bool Render(const DecodedInsn &insn, const uint64_t addr, size_t &len,
+              std::vector<BN::InstructionTextToken> &result) {
+    auto &slot = Slot(insn.opcode);
+    const Template *cached = slot.load(std::memory_order_acquire);
+    if (cached == nullptr) {
+      if (count.load(std::memory_order_relaxed) >= MAX_TEMPLATES) {
+        return render(insn, addr, len, result);
+      }
+      auto *built = new Template{};
+      if (!render(insn, addr, len, built->tokens)) {
+        delete built;
+        return false;
+      }
+      for (size_t i = 0; i < built->tokens.size(); i++) {
+        if (built->tokens[i].type == PossibleAddressToken) {
+          built->address_token = i;
+        }
+      }
+      // Another thread may have published the same opcode first
+      if (!slot.compare_exchange_strong(cached, built,
+                                        std::memory_order_acq_rel)) {
+        delete built;
+      } else {
+        cached = built;
+        count.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    len = Instruction::length;
+    const size_t first = result.size();
+    result.insert(result.end(), cached->tokens.begin(), cached->tokens.end());
+    if ((insn.flags & DecodedInsn::PC_RELATIVE) &&
+        cached->address_token != NO_ADDRESS) {
+      auto &token = result[first + cached->address_token];
+      token.text = FormatAddress(insn.target);
+      token.value = insn.target;
+    }
+    return true;
+  }
+
+  // Templates built so far; may briefly exceed MAX_TEMPLATES by the number
+  // of threads rendering at once
+  [[nodiscard]] size_t Size() const {
+    return count.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr size_t NO_ADDRESS = SIZE_MAX;
+  static constexpr size_t PAGE_SIZE = 0x100;
+
+  struct Template {
+    std::vector<BN::InstructionTextToken> tokens;
+    size_t address_token = NO_ADDRESS;  // index of the PC-relative target
+  };
+
+  struct Page {
+    std::array<std::atomic<const Template *>, PAGE_SIZE> slots{};
+  };
+
+  // Slot of `opcode`, allocating its page the first time it is used
+  std::atomic<const Template *> &Slot(const uint16_t opcode) {
+    auto &entry = pages[opcode / PAGE_SIZE];
+    Page *page = entry.load(std::memory_order_acquire);
+    if (page == nullptr) {
+      auto *fresh = new Page();
+      // Another thread may have allocated the same page first
+      if (entry.compare_exchange_strong(page, fresh,
+                                        std::memory_order_acq_rel)) {
+        page = fresh;
+      } else {
+        delete fresh;
+      }
+    }
+    return page->slots[opcode % PAGE_SIZE];
+  }
+
+  TextRenderer render;
+  std::array<std::atomic<Page *>, 0x10000 / PAGE_SIZE> pages{};
+  std::atomic<size_t> count{0};
+};
+}  // namespace SuperH
+
+#endif  // SRC_TEXT_CACHE_H_